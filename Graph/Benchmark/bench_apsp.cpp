@@ -0,0 +1,70 @@
+#include "bench_common.h"
+#include "graph_generators.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/*
+    All-pairs shortest path benchmark.
+
+    Algorithms:
+    - `floyd_warshall` : Shortet_Path/floyd_warshall_for_all_paths_from_all_nodes.cpp (dense O(n^3)).
+    - `floyd_warshall_compact` : the same file's shortest_paths<int>: flat distance matrix plus
+                         narrow next-hop matrix (read-only input, so no copies needed).
+    - `johnson`        : Shortet_Path/johnsons_all_pairs.cpp (Bellman-Ford potentials + one Dijkstra per
+                         source). The potentials are computed untimed; each worker streams all rows on
+                         a single thread and only counts reachable pairs.
+
+    Floyd-Warshall mutates its matrix in place, so every worker gets a fresh copy in the untimed
+    prepare step. It runs on ~2^(scale/2 + 2) vertices to keep the n^3 sweep bounded.
+*/
+
+namespace floyd_impl {
+#include "../Shortet_Path/floyd_warshall_for_all_paths_from_all_nodes.cpp"
+}
+#define main johnson_demo_main
+namespace johnson_impl {
+#include "../Shortet_Path/johnsons_all_pairs.cpp"
+}
+#undef main
+
+int main(int argc, char** argv) {
+    BenchOptions opt = parseBenchOptions(argc, argv);
+    int apspScale = max(4, opt.scale / 2 + 2);
+
+    for (string gen : {"rmat", "grid", "rgg"}) {
+        if (!opt.wants(gen)) continue;
+        EdgeList g = makeGraph(gen, apspScale, opt.seed, true);
+        vector<vector<int>> matrix = toAdjMatrix(g);
+        vector<vector<vector<int>>> copies;
+
+        BenchRecord rec;
+        rec.bench = "apsp";
+        rec.algorithm = "floyd_warshall";
+        rec.generator = gen;
+        rec.n = g.n;
+        rec.m = g.edges.size();
+        // Floyd-Warshall does n^3 relaxations regardless of m; report them next to edges/sec.
+        rec.extra.push_back({"relaxations", pow((double)g.n, 3)});
+        measureScaling(opt, rec,
+            [&](int T) { copies.assign(T, matrix); },
+            [&](int tid) { floyd_impl::Solution().shortest_distance(copies[tid]); });
+
+        BenchRecord crec = rec;
+        crec.algorithm = "floyd_warshall_compact";
+        measureScaling(opt, crec, [&](int) { floyd_impl::Solution().shortest_paths<int>(matrix); });
+
+        vector<vector<int>> triples = toEdgeTriples(g);
+        johnson_impl::JohnsonAllPairs johnson(g.n, triples);
+        BenchRecord jrec = rec;
+        jrec.algorithm = "johnson";
+        jrec.extra.clear();
+        measureScaling(opt, jrec, [&](int) {
+            long long reachable = 0;
+            johnson.forEachRow(1, [&](int, const vector<int>& row) {
+                for (int d : row) reachable += d != INT_MAX;
+            });
+        });
+    }
+    return 0;
+}
@@ -0,0 +1,61 @@
+#include "bench_common.h"
+#include "graph_generators.h"
+
+/*
+    Bridges and articulation points benchmark.
+
+    Algorithms:
+    - `bridges`             : Branch_And_Artulication_Point/branch.cpp's criticalConnections.
+    - `articulation_points` : Branch_And_Artulication_Point/articulation_point.cpp.
+    - `tarjan_vishkin`      : Branch_And_Artulication_Point/parallel_biconnectivity.cpp, both lists at once over
+                              every component. It is internally parallel, so `threads` is the engine's thread
+                              count for a single instance and `edges_per_sec` is m / seconds.
+
+    criticalConnections only explores the component of node 0, so the inputs use connected-ish
+    generators (grid, rgg) plus R-MAT, whose many degree-1 vertices produce lots of bridges.
+*/
+
+namespace bridge_impl {
+#include "../Branch_And_Artulication_Point/branch.cpp"
+}
+namespace ap_impl {
+#include "../Branch_And_Artulication_Point/articulation_point.cpp"
+}
+#define main tarjan_vishkin_demo_main
+namespace tv_impl {
+#include "../Branch_And_Artulication_Point/parallel_biconnectivity.cpp"
+}
+#undef main
+
+int main(int argc, char** argv) {
+    BenchOptions opt = parseBenchOptions(argc, argv);
+
+    for (string gen : {"rmat", "grid", "rgg"}) {
+        if (!opt.wants(gen)) continue;
+        EdgeList g = makeGraph(gen, opt.scale, opt.seed, false);
+        auto pairs = toEdgePairs(g);
+        auto adj = toAdjList(g);
+
+        BenchRecord rec;
+        rec.bench = "bridges";
+        rec.generator = gen;
+        rec.n = g.n;
+        rec.m = g.edges.size();
+
+        rec.algorithm = "bridges";
+        rec.extra = {{"bridges", (double)bridge_impl::Solution().criticalConnections(g.n, pairs).size()}};
+        measureScaling(opt, rec, [&](int) { bridge_impl::Solution().criticalConnections(g.n, pairs); });
+
+        rec.algorithm = "articulation_points";
+        rec.extra = {{"articulation_points", (double)ap_impl::Solution().articulationPoints(g.n, adj.data()).size()}};
+        measureScaling(opt, rec, [&](int) { ap_impl::Solution().articulationPoints(g.n, adj.data()); });
+
+        rec.algorithm = "tarjan_vishkin";
+        rec.extra.clear();
+        measureEngineScaling(opt, rec, [&](int T) -> vector<pair<string, double>> {
+            tv_impl::ParallelBiconnectivity engine(g.n, pairs, T);
+            return {{"bridges", (double)engine.bridges().size()}};
+        });
+    }
+    return 0;
+}
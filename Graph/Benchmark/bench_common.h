@@ -0,0 +1,243 @@
+#ifndef GRAPH_BENCHMARK_BENCH_COMMON_H
+#define GRAPH_BENCHMARK_BENCH_COMMON_H
+
+#include <bits/stdc++.h>
+#include <pthread.h>
+#include <sys/resource.h>
+#include "../Instrumentation/graph_counters.h"
+#include "../Weights/weight_traits.h"
+#include "../Workspace/query_workspace.h"
+using namespace std;
+
+/*
+    Shared harness for the graph benchmarks in this directory.
+
+    Every bench_<family>.cpp builds into its own executable:
+
+        g++ -O2 -std=c++17 -pthread bench_sssp.cpp -o bench_sssp
+        ./bench_sssp --scale=16 --reps=5 --threads=1,2,4,8
+
+    Options (all optional):
+    - `--scale=N`      : problem size exponent, graphs get roughly 2^N vertices.
+    - `--reps=N`       : repetitions per measurement, the median time is reported.
+    - `--threads=a,b`  : thread counts for the scaling sweep (default: 1 and all cores).
+    - `--generator=G`  : run only the named generator (rmat, grid, rgg, dag, raster).
+    - `--seed=N`       : seed for the synthetic generators.
+
+    Output is JSON Lines on stdout, one object per (algorithm, generator, threads) measurement:
+
+        {"schema":"graph-bench/1","bench":"sssp","algorithm":"dijkstra","generator":"rmat",
+         "n":65536,"m":524288,"threads":4,"reps":5,"seconds":0.41,"edges_per_sec":5.1e6,
+         "speedup":3.7,"peak_rss_kb":81234}
+
+    Scaling model:
+    - The algorithms in this repo are sequential, so the sweep runs `threads` independent
+      instances of the same query concurrently (each with its own source / copy of mutable inputs).
+    - `seconds` is the wall time of the whole batch, `edges_per_sec` is the aggregate
+      throughput (threads * m / seconds) and `speedup` is relative to the 1-thread throughput.
+    - This is exactly the number that matters when comparing engine variants for a query server,
+      and it exposes memory-bandwidth saturation on large graphs.
+
+    The algorithm sources are included inside per-algorithm namespaces (each defines its own
+    `Solution`), so the headers they depend on (counters, weight traits, query workspace) are
+    included here first, at global scope.
+
+    Most routines in this repo are recursive DFS, so every worker runs on a pthread with a
+    large stack (see `runThreads`) instead of the default 8 MB one.
+*/
+
+struct BenchOptions {
+    int scale = 14;
+    int reps = 3;
+    vector<int> threads;
+    string generator = "all";
+    uint64_t seed = 42;
+
+    bool wants(const string& gen) const {
+        return generator == "all" || generator == gen;
+    }
+};
+
+inline BenchOptions parseBenchOptions(int argc, char** argv) {
+    BenchOptions opt;
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        auto value = [&](const string& key) -> const char* {
+            if (arg.rfind(key + "=", 0) == 0) return argv[i] + key.size() + 1;
+            return nullptr;
+        };
+        if (const char* v = value("--scale")) opt.scale = atoi(v);
+        else if (const char* v = value("--reps")) opt.reps = max(1, atoi(v));
+        else if (const char* v = value("--generator")) opt.generator = v;
+        else if (const char* v = value("--seed")) opt.seed = strtoull(v, nullptr, 10);
+        else if (const char* v = value("--threads")) {
+            stringstream ss(v);
+            string tok;
+            while (getline(ss, tok, ',')) {
+                if (!tok.empty()) opt.threads.push_back(max(1, atoi(tok.c_str())));
+            }
+        }
+        else {
+            cerr << "unknown option: " << arg << endl;
+            exit(2);
+        }
+    }
+    if (opt.threads.empty()) {
+        int hw = max(1u, thread::hardware_concurrency());
+        opt.threads.push_back(1);
+        if (hw > 1) opt.threads.push_back(hw);
+    }
+    return opt;
+}
+
+inline double nowSeconds() {
+    return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Peak resident set size of the whole process in KB (Linux reports ru_maxrss in KB).
+inline long peakRssKb() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+// Runs fn(tid) on `count` pthreads, each with a `stackBytes` stack, and waits for all of them.
+inline void runThreads(int count, const function<void(int)>& fn, size_t stackBytes = size_t(1) << 30) {
+    struct Task {
+        const function<void(int)>* fn;
+        int tid;
+    };
+    vector<pthread_t> handles(count);
+    vector<Task> tasks(count);
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, stackBytes);
+    for (int t = 0; t < count; t++) {
+        tasks[t] = {&fn, t};
+        auto entry = [](void* p) -> void* {
+            Task* task = static_cast<Task*>(p);
+            (*task->fn)(task->tid);
+            return nullptr;
+        };
+        if (pthread_create(&handles[t], &attr, entry, &tasks[t]) != 0) {
+            cerr << "pthread_create failed" << endl;
+            exit(1);
+        }
+    }
+    for (int t = 0; t < count; t++) pthread_join(handles[t], nullptr);
+    pthread_attr_destroy(&attr);
+}
+
+inline string jsonEscape(const string& s) {
+    string out;
+    for (char c : s) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+// One measurement; printed as a single JSON line.
+struct BenchRecord {
+    string bench, algorithm, generator;
+    long long n = 0, m = 0;
+    int threads = 1, reps = 1;
+    double seconds = 0, edgesPerSec = 0, speedup = 1;
+    long peakRss = 0;
+    vector<pair<string, double>> extra;  // Algorithm-specific numbers (e.g. result checksums)
+
+    void print() const {
+        cout << fixed << setprecision(6);
+        cout << "{\"schema\":\"graph-bench/1\""
+             << ",\"bench\":\"" << jsonEscape(bench) << "\""
+             << ",\"algorithm\":\"" << jsonEscape(algorithm) << "\""
+             << ",\"generator\":\"" << jsonEscape(generator) << "\""
+             << ",\"n\":" << n << ",\"m\":" << m
+             << ",\"threads\":" << threads << ",\"reps\":" << reps
+             << ",\"seconds\":" << seconds
+             << ",\"edges_per_sec\":" << edgesPerSec
+             << ",\"speedup\":" << speedup
+             << ",\"peak_rss_kb\":" << peakRss;
+        for (auto& kv : extra) cout << ",\"" << jsonEscape(kv.first) << "\":" << kv.second;
+        cout << "}" << endl;
+    }
+};
+
+/*
+    Runs the thread-scaling sweep for one (algorithm, generator) pair.
+
+    - `prepare(T)` is called untimed before every repetition, so kernels that mutate their input
+      (Floyd-Warshall, Kruskal's mstGraph, ...) can hand each of the T workers a fresh copy.
+    - `run(tid)` is the timed kernel for worker `tid`.
+*/
+inline void measureScaling(const BenchOptions& opt, BenchRecord base,
+                           const function<void(int)>& prepare,
+                           const function<void(int)>& run) {
+    double baseThroughput = 0;
+    for (int T : opt.threads) {
+        vector<double> times;
+        for (int r = 0; r < opt.reps; r++) {
+            prepare(T);
+            double start = nowSeconds();
+            runThreads(T, run);
+            times.push_back(nowSeconds() - start);
+        }
+        sort(times.begin(), times.end());
+
+        BenchRecord rec = base;
+        rec.threads = T;
+        rec.reps = opt.reps;
+        rec.seconds = times[times.size() / 2];
+        rec.edgesPerSec = rec.seconds > 0 ? double(T) * double(rec.m) / rec.seconds : 0;
+        if (baseThroughput == 0) baseThroughput = rec.edgesPerSec;
+        rec.speedup = baseThroughput > 0 ? rec.edgesPerSec / baseThroughput : 1;
+        rec.peakRss = peakRssKb();
+        rec.print();
+    }
+}
+
+// Convenience overload for kernels with read-only inputs.
+inline void measureScaling(const BenchOptions& opt, BenchRecord base, const function<void(int)>& run) {
+    measureScaling(opt, base, [](int) {}, run);
+}
+
+/*
+    Thread-scaling sweep for an engine that is parallel inside one run (T threads cooperate on one instance
+    instead of measureScaling's T independent copies).
+
+    - `run(T)` is the timed kernel, called on this thread once per repetition; the extra fields it returns
+      (from the last repetition) are appended to the record.
+    - `edges_per_sec` is m / seconds. `speedup` is baselineSeconds / seconds, where baselineSeconds defaults
+      to this sweep's first thread count; the return value is that first median, so a variant can be
+      reported relative to another one.
+*/
+inline double measureEngineScaling(const BenchOptions& opt, BenchRecord base,
+                                   const function<vector<pair<string, double>>(int)>& run,
+                                   double baselineSeconds = 0) {
+    double first = 0;
+    for (int T : opt.threads) {
+        vector<double> times;
+        vector<pair<string, double>> extra;
+        for (int r = 0; r < opt.reps; r++) {
+            double start = nowSeconds();
+            extra = run(T);
+            times.push_back(nowSeconds() - start);
+        }
+        sort(times.begin(), times.end());
+
+        BenchRecord rec = base;
+        rec.threads = T;
+        rec.reps = opt.reps;
+        rec.seconds = times[times.size() / 2];
+        rec.edgesPerSec = rec.seconds > 0 ? double(rec.m) / rec.seconds : 0;
+        if (first == 0) first = rec.seconds;
+        double baseline = baselineSeconds > 0 ? baselineSeconds : first;
+        rec.speedup = rec.seconds > 0 ? baseline / rec.seconds : 1;
+        rec.peakRss = peakRssKb();
+        rec.extra.insert(rec.extra.end(), extra.begin(), extra.end());
+        rec.print();
+    }
+    return first;
+}
+
+#endif
@@ -0,0 +1,145 @@
+#include "bench_common.h"
+#include "graph_generators.h"
+#include "../Compression/compressed_graph.h"
+#include "../Reordering/graph_reordering.h"
+
+/*
+    Compressed adjacency benchmark: memory and traversal time of Compression/compressed_graph.h against the flat
+    vector<vector<int>> lists, running the unchanged repo routines on both.
+
+    Algorithms (`algorithm` is "<name>/flat" or "<name>/compressed"):
+    - `unit_bfs`       : workspace unit-weight BFS over the symmetric neighbour lists, whole component of the
+                         highest-degree node.
+    - `kosaraju`       : strongly_connected_componenets.cpp on the directed lists.
+    - `dsu_components` : DisjointSet (Disjoint_Set_Union/disjoint_set_union.cpp) over every undirected edge.
+    - `kahn_bfs`, `topo_dfs` : both topological sorts, `dag` generator only.
+
+    Extra fields per record:
+    - `bytes`, `bits_per_edge` : heap size of the representation the algorithm ran on.
+    - `ratio`     : flat bytes / this representation's bytes.
+    - `ratio_rcm` : the same ratio when the graph is compressed after an RCM relabeling (gaps shrink).
+    - `mismatch`  : 1 if the compressed run's result (reached-distance checksum, SCC count, component count,
+                    topological order validity) differs from the flat run.
+*/
+
+namespace unit_bfs_impl {
+#include "../Shortet_Path/shortest_path_in_undirected_graph_with_unit_weight.cpp"
+}
+namespace scc_impl {
+#include "../strongly_connected_componenets.cpp"
+}
+#define main dsu_demo_main
+namespace dsu_impl {
+#include "../Disjoint_Set_Union/disjoint_set_union.cpp"
+}
+#undef main
+namespace kahn_impl {
+#include "../Topological_Sort/topo_sort_bfs.cpp"
+}
+namespace topo_dfs_impl {
+#include "../Topological_Sort/toposort_dfs.cpp"
+}
+
+static size_t flatBytes(const vector<vector<int>>& adj) {
+    size_t bytes = adj.capacity() * sizeof(vector<int>);
+    for (auto& list : adj) bytes += list.capacity() * sizeof(int);
+    return bytes;
+}
+
+template <class Graph>
+static long long bfsChecksum(int n, const Graph& adj, int source, QueryWorkspace<int>& ws) {
+    unit_bfs_impl::Solution().shortestPath(n, adj, source, -1, ws);
+    long long sum = 0;
+    for (int v : ws.order) sum += ws.dist.get(v);
+    return sum;
+}
+
+template <class Graph>
+static int dsuComponents(int n, const Graph& adj) {
+    dsu_impl::DisjointSet<> ds(n);
+    for (int u = 0; u < n; u++)
+        for (int v : adj[u])
+            if (u < v) ds.unionBySize(u, v);
+    int components = 0;
+    for (int v = 0; v < n; v++) components += ds.findUPar(v) == v;
+    return components;
+}
+
+template <class Graph>
+static bool isTopological(const Graph& adj, const vector<int>& order) {
+    vector<int> position(adj.size(), -1);
+    for (size_t i = 0; i < order.size(); i++) position[order[i]] = i;
+    if ((size_t)count(position.begin(), position.end(), -1) != 0) return false;
+    for (size_t u = 0; u < adj.size(); u++)
+        for (int v : adj[u])
+            if (position[u] >= position[v]) return false;
+    return true;
+}
+
+int main(int argc, char** argv) {
+    BenchOptions opt = parseBenchOptions(argc, argv);
+
+    for (string gen : {"rmat", "grid", "rgg", "dag"}) {
+        if (!opt.wants(gen)) continue;
+        EdgeList g = makeGraph(gen, opt.scale, opt.seed, true);
+        auto adj = toAdjList(g);
+        auto nbrs = symmetricNeighbours(adj);
+        CompressedGraph cAdj(adj), cNbrs(nbrs);
+
+        Relabeling r = rcmOrder(nbrs);
+        double ratioRcm = (double)flatBytes(adj) / CompressedGraph(r.permuteAdjList(adj)).bytes();
+        int source = 0;
+        for (int v = 0; v < g.n; v++)
+            if (nbrs[v].size() > nbrs[source].size()) source = v;
+
+        BenchRecord rec;
+        rec.bench = "compressed";
+        rec.generator = gen;
+        rec.n = g.n;
+
+        // Runs one kernel on both representations; check(flat) returns the value compared for `mismatch`.
+        auto runBoth = [&](const string& algo, const vector<vector<int>>& flat, const CompressedGraph& packed,
+                           const function<double(bool)>& kernel) {
+            double flatResult = 0, packedResult = 0;
+            runThreads(1, [&](int) {
+                flatResult = kernel(false);
+                packedResult = kernel(true);
+            });
+            long long edges = packed.edges();
+            size_t bytes[2] = {flatBytes(flat), packed.bytes()};
+            for (int compressed = 0; compressed < 2; compressed++) {
+                rec.algorithm = algo + (compressed ? "/compressed" : "/flat");
+                rec.m = edges;
+                rec.extra = {{"bytes", (double)bytes[compressed]},
+                             {"bits_per_edge", edges ? 8.0 * bytes[compressed] / edges : 0},
+                             {"ratio", (double)bytes[0] / bytes[compressed]},
+                             {"ratio_rcm", ratioRcm},
+                             {"mismatch", (double)(flatResult != packedResult)}};
+                measureScaling(opt, rec, [&](int) { kernel(compressed); });
+            }
+        };
+
+        runBoth("unit_bfs", nbrs, cNbrs, [&](bool compressed) {
+            QueryWorkspace<int> ws;
+            return (double)(compressed ? bfsChecksum(g.n, cNbrs, source, ws) : bfsChecksum(g.n, nbrs, source, ws));
+        });
+        runBoth("kosaraju", adj, cAdj, [&](bool compressed) {
+            return (double)(compressed ? scc_impl::solution().kosaraju(g.n, cAdj)
+                                       : scc_impl::solution().kosaraju(g.n, adj));
+        });
+        runBoth("dsu_components", nbrs, cNbrs, [&](bool compressed) {
+            return (double)(compressed ? dsuComponents(g.n, cNbrs) : dsuComponents(g.n, nbrs));
+        });
+        if (gen == "dag") {
+            runBoth("kahn_bfs", adj, cAdj, [&](bool compressed) {
+                return (double)(compressed ? isTopological(adj, kahn_impl::Solution().topoSort(g.n, cAdj))
+                                           : isTopological(adj, kahn_impl::Solution().topoSort(g.n, adj.data())));
+            });
+            runBoth("topo_dfs", adj, cAdj, [&](bool compressed) {
+                return (double)(compressed ? isTopological(adj, topo_dfs_impl::topologicalSort(cAdj))
+                                           : isTopological(adj, topo_dfs_impl::topologicalSort(adj)));
+            });
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,92 @@
+#include "bench_common.h"
+#include "graph_generators.h"
+
+/*
+    Disjoint Set Union benchmark.
+
+    Algorithms:
+    - `union_find` : Disjoint_Set_Union/disjoint_set_union.cpp, one unionBySize per edge followed by
+                     one findUPar per vertex (the access pattern of connectivity queries).
+    - `solve`      : Disjoint_Set_Union/find_edges_to_connect_graph.cpp's Solve (operations needed
+                     to connect the graph).
+    - `parallel_cc/<variant>` : Disjoint_Set_Union/parallel_connected_components.cpp with T threads inside one
+                     run (not T independent runs; measureEngineScaling, `speedup` is relative to its own
+                     first thread count). Variants: `afforest_edges` (Solve's edge list), `afforest_adj`
+                     (symmetric adjacency lists, giant component skipped), `shiloach_vishkin` (edge list).
+                     Extra fields: `operations`, `skipped`, `mismatch` (1 if the answer differs from Solve).
+
+    R-MAT inputs stress path compression on a giant component, grids and geometric graphs build long
+    chains before they merge.
+*/
+
+#define main dsu_demo_main
+namespace dsu_impl {
+#include "../Disjoint_Set_Union/disjoint_set_union.cpp"
+}
+#undef main
+#define main solve_demo_main
+namespace solve_impl {
+#include "../Disjoint_Set_Union/find_edges_to_connect_graph.cpp"
+}
+#undef main
+#define main pcc_demo_main
+namespace pcc_impl {
+#include "../Disjoint_Set_Union/parallel_connected_components.cpp"
+}
+#undef main
+
+int main(int argc, char** argv) {
+    BenchOptions opt = parseBenchOptions(argc, argv);
+
+    for (string gen : {"rmat", "grid", "rgg"}) {
+        if (!opt.wants(gen)) continue;
+        EdgeList g = makeGraph(gen, opt.scale, opt.seed, false);
+        auto pairs = toEdgePairs(g);
+        // The edge order matters for union-find; shuffle so it is not the generator's sorted order.
+        shuffle(pairs.begin(), pairs.end(), mt19937_64(opt.seed));
+
+        BenchRecord rec;
+        rec.bench = "dsu";
+        rec.generator = gen;
+        rec.n = g.n;
+        rec.m = g.edges.size();
+
+        rec.algorithm = "union_find";
+        measureScaling(opt, rec, [&](int) {
+            dsu_impl::DisjointSet ds(g.n);
+            for (auto& e : pairs) ds.unionBySize(e[0], e[1]);
+            volatile long long sink = 0;
+            for (int i = 0; i < g.n; i++) sink += ds.findUPar(i);
+        });
+
+        int operations = solve_impl::Solution().Solve(g.n, pairs);
+        rec.algorithm = "solve";
+        rec.extra = {{"operations", (double)operations}};
+        measureScaling(opt, rec, [&](int) { solve_impl::Solution().Solve(g.n, pairs); });
+
+        // Parallel engine: the threads are inside one run
+        vector<vector<int>> adj(g.n);
+        for (auto& e : pairs) {
+            adj[e[0]].push_back(e[1]);
+            if (e[0] != e[1]) adj[e[1]].push_back(e[0]);
+        }
+        using pcc_impl::ParallelConnectedComponents;
+        for (string variant : {"afforest_edges", "afforest_adj", "shiloach_vishkin"}) {
+            pcc_impl::ComponentsOptions options;
+            if (variant == "shiloach_vishkin") options.method = pcc_impl::ComponentsMethod::ShiloachVishkin;
+            BenchRecord par = rec;
+            par.algorithm = "parallel_cc/" + variant;
+            par.extra.clear();
+            measureEngineScaling(opt, par, [&](int T) -> vector<pair<string, double>> {
+                ParallelConnectedComponents cc = variant == "afforest_adj"
+                                                     ? ParallelConnectedComponents::fromGraph(g.n, adj, T, options)
+                                                     : ParallelConnectedComponents(g.n, pairs, T, options);
+                int answer = cc.operationsNeeded();
+                return {{"operations", (double)answer},
+                        {"skipped", (double)cc.stats().skipped},
+                        {"mismatch", (double)(answer != operations)}};
+            });
+        }
+    }
+    return 0;
+}
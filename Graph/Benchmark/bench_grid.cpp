@@ -0,0 +1,181 @@
+#include "bench_common.h"
+#include "graph_generators.h"
+#include "../Grid/grid_graph.h"
+#include "../Memory/numa_memory.h"
+
+/*
+    Implicit grid benchmark: Grid/grid_graph.h against the same raster materialized as adjacency lists, running
+    the unchanged repo routines on both.
+
+    Algorithms (`algorithm` is "<name>/<4|8>/lists" or "<name>/<4|8>/implicit"):
+    - `unit_bfs`       : workspace unit-weight BFS from an open cell of the largest island.
+    - `dijkstra`       : workspace dijkstra from the same cell, random 1..9 cell costs, straight / diagonal steps
+                         scaled 10 / 14.
+    - `dsu_components` : DisjointSet over every edge (`forEachEdge` on the implicit grid).
+    - `kosaraju`       : strongly_connected_componenets.cpp (every island, and every blocked cell, is one SCC).
+    - `lazy_nearest`   : Shortet_Path/lazy_dijkstra.cpp, the 1000 nearest cells of the source; the implicit run
+                         passes the temporary `grid.weighted()` view.
+
+    Extra fields per record:
+    - `bytes`    : heap size of the representation the algorithm ran on (lists: vector<vector<int>> for BFS and
+                   DSU, vector<vector<array<int, 2>>> for dijkstra; implicit: occupancy bits + cost bytes).
+    - `ratio`    : lists bytes / implicit bytes.
+    - `islands`  : components among open cells.
+    - `mismatch` : 1 if the implicit run's result (reached-distance checksum, component / SCC count, nearest
+                   distance sum) differs from the lists run.
+*/
+
+namespace unit_bfs_impl {
+#include "../Shortet_Path/shortest_path_in_undirected_graph_with_unit_weight.cpp"
+}
+namespace dijkstra_impl {
+#include "../Shortet_Path/dijkstras_positive_weights.cpp"
+}
+#define main dsu_demo_main
+namespace dsu_impl {
+#include "../Disjoint_Set_Union/disjoint_set_union.cpp"
+}
+#undef main
+namespace scc_impl {
+#include "../strongly_connected_componenets.cpp"
+}
+#define main lazy_demo_main
+namespace lazy_impl {
+#include "../Shortet_Path/lazy_dijkstra.cpp"
+}
+#undef main
+
+template <class List>
+static size_t listBytes(const vector<vector<List>>& adj) {
+    size_t bytes = adj.capacity() * sizeof(vector<List>);
+    for (auto& list : adj) bytes += list.capacity() * sizeof(List);
+    return bytes;
+}
+
+int main(int argc, char** argv) {
+    BenchOptions opt = parseBenchOptions(argc, argv);
+    if (!opt.wants("raster")) return 0;
+
+    int side = max(2, (int)sqrt((double)(1 << opt.scale)));
+    mt19937_64 rng(opt.seed);
+    vector<uint8_t> cost((size_t)side * side);
+    for (auto& c : cost) c = rng() % 9 + 1;
+
+    for (GridConnectivity conn : {GridConnectivity::Four, GridConnectivity::Eight}) {
+        for (double density : {0.5, 0.65}) {
+            vector<vector<int>> raster = randomRaster(side, side, density, opt.seed);
+            GridGraph grid(raster, conn);
+            grid.setCosts(cost, 10, 14);
+            int n = grid.size();
+
+            // Materialized lists, built from the raster independently of GridGraph
+            vector<vector<int>> nbrs(n);
+            vector<vector<array<int, 2>>> arcs(n);
+            long long m = 0;
+            for (int r = 0; r < side; r++) {
+                for (int c = 0; c < side; c++) {
+                    if (!raster[r][c]) continue;
+                    for (int dr = -1; dr <= 1; dr++) {
+                        for (int dc = -1; dc <= 1; dc++) {
+                            int nr = r + dr, nc = c + dc, diagonal = dr != 0 && dc != 0;
+                            if ((dr == 0 && dc == 0) || (diagonal && conn == GridConnectivity::Four)) continue;
+                            if (nr < 0 || nc < 0 || nr >= side || nc >= side || !raster[nr][nc]) continue;
+                            int u = r * side + c, v = nr * side + nc;
+                            nbrs[u].push_back(v);
+                            arcs[u].push_back({v, cost[v] * (diagonal ? 14 : 10)});
+                            m++;
+                        }
+                    }
+                }
+            }
+            raster.clear();
+            raster.shrink_to_fit();
+
+            // Components and the source: an open cell of the largest island
+            dsu_impl::DisjointSet<> ds(n);
+            grid.forEachEdge([&](int u, int v) { ds.unionBySize(u, v); });
+            vector<int> islandSize(n, 0);
+            int islands = 0, source = 0;
+            for (int v = 0; v < n; v++) {
+                if (!grid.open(v)) continue;
+                int root = ds.findUPar(v);
+                islands += root == v;
+                if (++islandSize[root] > islandSize[ds.findUPar(source)] || !grid.open(source)) source = v;
+            }
+
+            BenchRecord rec;
+            rec.bench = "grid";
+            rec.generator = "raster";
+            rec.n = n;
+            rec.m = m;
+            string tag = to_string((int)conn);
+
+            // Runs one kernel on both representations; kernel(implicit) returns the value compared for `mismatch`.
+            auto runBoth = [&](const string& algo, size_t lists, const function<double(bool)>& kernel) {
+                double listResult = 0, implicitResult = 0;
+                runThreads(1, [&](int) {
+                    listResult = kernel(false);
+                    implicitResult = kernel(true);
+                });
+                size_t bytes[2] = {lists, grid.bytes()};
+                for (int implicit = 0; implicit < 2; implicit++) {
+                    rec.algorithm = algo + "/" + tag + (implicit ? "/implicit" : "/lists");
+                    rec.extra = {{"density", density},
+                                 {"bytes", (double)bytes[implicit]},
+                                 {"ratio", (double)bytes[0] / bytes[implicit]},
+                                 {"islands", (double)islands},
+                                 {"mismatch", (double)(listResult != implicitResult)}};
+                    measureScaling(opt, rec, [&](int) { kernel(implicit); });
+                }
+            };
+
+            runBoth("unit_bfs", listBytes(nbrs), [&](bool implicit) {
+                QueryWorkspace<int> ws;
+                if (implicit) unit_bfs_impl::Solution().shortestPath(n, grid, source, -1, ws);
+                else unit_bfs_impl::Solution().shortestPath(n, nbrs, source, -1, ws);
+                long long sum = 0;
+                for (int v : ws.order) sum += ws.dist.get(v);
+                return (double)sum;
+            });
+            runBoth("dijkstra", listBytes(arcs), [&](bool implicit) {
+                QueryWorkspace<int> ws;
+                if (implicit) dijkstra_impl::Solution().dijkstra(n, grid.weighted(), source, -1, ws);
+                else dijkstra_impl::Solution().dijkstra(n, arcs, source, -1, ws);
+                long long sum = 0;
+                for (int v : ws.order) sum += ws.dist.get(v);
+                return (double)sum;
+            });
+            runBoth("dsu_components", listBytes(nbrs), [&](bool implicit) {
+                dsu_impl::DisjointSet<> dsu(n);
+                if (implicit) grid.forEachEdge([&](int u, int v) { dsu.unionBySize(u, v); });
+                else
+                    for (int u = 0; u < n; u++)
+                        for (int v : nbrs[u])
+                            if (u < v) dsu.unionBySize(u, v);
+                int components = 0;
+                for (int v = 0; v < n; v++) components += grid.open(v) && dsu.findUPar(v) == v;
+                return (double)components;
+            });
+            runBoth("kosaraju", listBytes(nbrs), [&](bool implicit) {
+                return (double)(implicit ? scc_impl::solution().kosaraju(n, grid) : scc_impl::solution().kosaraju(n, nbrs));
+            });
+            runBoth("lazy_nearest", listBytes(arcs), [&](bool implicit) {
+                QueryWorkspace<int> ws;
+                vector<pair<int, int>> nearest;
+                if (implicit) {
+                    lazy_impl::LazyDijkstra search(n, grid.weighted(), ws);  // Temporary view, copied into the search
+                    search.start(source);
+                    nearest = search.nearest(1000);
+                } else {
+                    lazy_impl::LazyDijkstra search(n, arcs, ws);
+                    search.start(source);
+                    nearest = search.nearest(1000);
+                }
+                long long sum = 0;
+                for (auto& e : nearest) sum += e.second;
+                return (double)sum;
+            });
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,38 @@
+#include "bench_common.h"
+#include "graph_generators.h"
+
+/*
+    Distinct islands benchmark.
+
+    Algorithms:
+    - `distinct_islands` : Imp_Questions/number_of_distinct_islands.cpp on smoothed random rasters.
+
+    `n` is the number of cells and `m` the number of 4-neighbour adjacencies, so edges/sec is
+    comparable with the graph benchmarks. Densities below and above the percolation threshold
+    give many small islands vs. one huge island respectively.
+*/
+
+namespace islands_impl {
+#include "../Imp_Questions/number_of_distinct_islands.cpp"
+}
+
+int main(int argc, char** argv) {
+    BenchOptions opt = parseBenchOptions(argc, argv);
+    if (!opt.wants("raster")) return 0;
+
+    int side = max(2, (int)sqrt((double)(1 << opt.scale)));
+    for (double density : {0.35, 0.5, 0.65}) {
+        vector<vector<int>> grid = randomRaster(side, side, density, opt.seed);
+
+        BenchRecord rec;
+        rec.bench = "islands";
+        rec.algorithm = "distinct_islands";
+        rec.generator = "raster";
+        rec.n = 1LL * side * side;
+        rec.m = 2LL * side * (side - 1);
+        rec.extra = {{"density", density},
+                     {"distinct_islands", (double)islands_impl::Solution().countDistinctIslands(grid)}};
+        measureScaling(opt, rec, [&](int) { islands_impl::Solution().countDistinctIslands(grid); });
+    }
+    return 0;
+}
@@ -0,0 +1,51 @@
+#include "bench_common.h"
+#include "graph_generators.h"
+
+/*
+    Minimum spanning tree benchmark.
+
+    Algorithms:
+    - `kruskal` : MST/kruskal's.cpp (edge list sort + DisjointSet), also builds the MST graph.
+    - `prim`    : MST/minimam_spaning_tree_weight.cpp (lazy priority queue).
+
+    Inputs are undirected; the `mst_weight` field must agree between the two algorithms.
+*/
+
+#define main kruskal_demo_main
+namespace kruskal_impl {
+#include "../MST/kruskal's.cpp"
+}
+#undef main
+namespace prim_impl {
+#include "../MST/minimam_spaning_tree_weight.cpp"
+}
+
+int main(int argc, char** argv) {
+    BenchOptions opt = parseBenchOptions(argc, argv);
+
+    for (string gen : {"rmat", "grid", "rgg"}) {
+        if (!opt.wants(gen)) continue;
+        EdgeList g = makeGraph(gen, opt.scale, opt.seed, false);
+        auto adj = toWeightedAdj(g);
+        vector<vector<vector<int>>> mstGraphs;
+
+        BenchRecord rec;
+        rec.bench = "mst";
+        rec.generator = gen;
+        rec.n = g.n;
+        rec.m = g.edges.size();
+
+        vector<vector<int>> probe(g.n);
+        rec.algorithm = "kruskal";
+        rec.extra = {{"mst_weight", (double)kruskal_impl::Solution().spanningTree(g.n, adj.data(), probe)}};
+        measureScaling(opt, rec,
+            [&](int T) { mstGraphs.assign(T, vector<vector<int>>(g.n)); },
+            [&](int tid) { kruskal_impl::Solution().spanningTree(g.n, adj.data(), mstGraphs[tid]); });
+
+        // Prim only spans the component of node 0, so its weight matches Kruskal on connected inputs.
+        rec.algorithm = "prim";
+        rec.extra = {{"mst_weight", (double)prim_impl::spanningTree(g.n, adj.data())}};
+        measureScaling(opt, rec, [&](int) { prim_impl::spanningTree(g.n, adj.data()); });
+    }
+    return 0;
+}
@@ -0,0 +1,172 @@
+#include "bench_common.h"
+#include "graph_generators.h"
+#include "../Memory/numa_memory.h"
+
+/*
+    Memory placement benchmark: the same CSR graph in std::vector and in LargeArray (Memory/numa_memory.h) under
+    different page / NUMA policies, traversed by the workspace engines.
+
+    Layouts (`algorithm` is "<engine>/<layout>"):
+    - `vector`      : std::vector, filled on the main thread (the default everywhere else in the repo).
+    - `thp`         : LargeArray, transparent huge pages, first touch by the T fill workers.
+    - `interleave`  : transparent huge pages, pages interleaved over all NUMA nodes.
+    - `partitioned` : transparent huge pages, range t bound to node numaNodeOf(t) (the online ids round-robin).
+    - `explicit`    : MAP_HUGETLB pages (falls back to transparent when the hugetlbfs pool is empty).
+
+    Engines (T concurrent queries from different sources, one QueryWorkspace per worker):
+    - `unit_bfs` : Shortet_Path/shortest_path_in_undirected_graph_with_unit_weight.cpp, whole component.
+    - `dijkstra` : Shortet_Path/dijkstras_positive_weights.cpp, whole component.
+    - `scratch_init` : filling an n-element distance array, std::vector on one thread against LargeArray::firstTouch
+                       with T workers (`m` is n here, `speedup` is relative to the vector fill at the first
+                       thread count).
+
+    Extra fields per record:
+    - `build_seconds` : time to lay the graph out.
+    - `anon_huge_kb`  : AnonHugePages of the process after the build, `explicit_pages` : 1 if MAP_HUGETLB succeeded.
+    - `numa_nodes`    : online nodes. On a single-node machine the NUMA layouts only differ in page size.
+    - `numa_bound`    : 1 if the layout's NUMA policy was applied and every mbind succeeded (usedNumaBinding()).
+    - `mismatch`      : 1 if a query's reached-distance checksum differs from the `vector` layout.
+*/
+
+namespace unit_bfs_impl {
+#include "../Shortet_Path/shortest_path_in_undirected_graph_with_unit_weight.cpp"
+}
+namespace dijkstra_impl {
+#include "../Shortet_Path/dijkstras_positive_weights.cpp"
+}
+
+// Offsets plus targets (for BFS) and {v, w} arcs (for dijkstra), in any array type.
+template <class Offsets, class Targets, class Arcs>
+struct CsrLayout {
+    Offsets offset;
+    Targets target;
+    Arcs arc;
+};
+
+template <class Graph>
+static long long bfsChecksum(int n, const Graph& adj, int source, QueryWorkspace<int>& ws) {
+    unit_bfs_impl::Solution().shortestPath(n, adj, source, -1, ws);
+    long long sum = 0;
+    for (int v : ws.order) sum += ws.dist.get(v);
+    return sum;
+}
+
+template <class Graph>
+static long long dijkstraChecksum(int n, const Graph& adj, int source, QueryWorkspace<int>& ws) {
+    dijkstra_impl::Solution().dijkstra(n, adj, source, -1, ws);
+    long long sum = 0;
+    for (int v : ws.order) sum += ws.dist.get(v);
+    return sum;
+}
+
+int main(int argc, char** argv) {
+    BenchOptions opt = parseBenchOptions(argc, argv);
+    int fillThreads = *max_element(opt.threads.begin(), opt.threads.end());
+
+    for (string gen : {"rmat", "grid", "rgg"}) {
+        if (!opt.wants(gen)) continue;
+        EdgeList g = makeGraph(gen, opt.scale, opt.seed, false);
+        auto adj = toWeightedAdj(g);
+        int n = g.n;
+
+        // Reference CSR in plain vectors
+        vector<long long> offset(n + 1, 0);
+        for (int u = 0; u < n; u++) offset[u + 1] = offset[u] + adj[u].size();
+        long long m = offset[n];
+        vector<int> target(m);
+        vector<array<int, 2>> arc(m);
+        for (int u = 0; u < n; u++) {
+            for (size_t i = 0; i < adj[u].size(); i++) {
+                target[offset[u] + i] = adj[u][i][0];
+                arc[offset[u] + i] = {adj[u][i][0], adj[u][i][1]};
+            }
+        }
+        adj.clear();
+        adj.shrink_to_fit();
+
+        // Sources: the highest-degree nodes, so every query explores the giant component
+        vector<int> sources(n);
+        iota(sources.begin(), sources.end(), 0);
+        int k = min(n, 16);
+        partial_sort(sources.begin(), sources.begin() + k, sources.end(),
+                     [&](int a, int b) { return offset[a + 1] - offset[a] > offset[b + 1] - offset[b]; });
+        sources.resize(k);
+
+        vector<long long> refBfs(k), refDijkstra(k);
+        BenchRecord rec;
+        rec.bench = "numa";
+        rec.generator = gen;
+        rec.n = n;
+
+        auto runLayout = [&](const string& layout, const auto& csr, double buildSeconds, bool explicitPages,
+                             bool numaBound) {
+            CsrRows<int> unweighted(csr.offset.data(), csr.target.data(), n);
+            CsrRows<array<int, 2>> weighted(csr.offset.data(), csr.arc.data(), n);
+            double mismatch = 0;
+            runThreads(1, [&](int) {
+                QueryWorkspace<int> ws;
+                for (int i = 0; i < k; i++) {
+                    long long b = bfsChecksum(n, unweighted, sources[i], ws), d = dijkstraChecksum(n, weighted, sources[i], ws);
+                    if (layout == "vector") refBfs[i] = b, refDijkstra[i] = d;
+                    if (b != refBfs[i] || d != refDijkstra[i]) mismatch = 1;
+                }
+            });
+            rec.m = m;
+            rec.extra = {{"build_seconds", buildSeconds}, {"anon_huge_kb", (double)anonHugePagesKb()},
+                         {"explicit_pages", (double)explicitPages}, {"numa_nodes", (double)numaNodeCount()},
+                         {"numa_bound", (double)numaBound}, {"mismatch", mismatch}};
+            vector<QueryWorkspace<int>> ws;
+            auto prepare = [&](int T) { ws.resize(T); };
+            rec.algorithm = "unit_bfs/" + layout;
+            measureScaling(opt, rec, prepare, [&](int tid) { bfsChecksum(n, unweighted, sources[tid % k], ws[tid]); });
+            rec.algorithm = "dijkstra/" + layout;
+            measureScaling(opt, rec, prepare,
+                           [&](int tid) { dijkstraChecksum(n, weighted, sources[tid % k], ws[tid]); });
+        };
+
+        {
+            double t0 = nowSeconds();
+            CsrLayout<vector<long long>, vector<int>, vector<array<int, 2>>> csr{offset, target, arc};
+            runLayout("vector", csr, nowSeconds() - t0, false, false);
+        }
+
+        vector<pair<string, MemoryPolicy>> policies = {
+            {"thp", {PagePolicy::Transparent, NumaPolicy::FirstTouch, 1}},
+            {"interleave", {PagePolicy::Transparent, NumaPolicy::Interleave, 1}},
+            {"partitioned", {PagePolicy::Transparent, NumaPolicy::Partitioned, fillThreads}},
+            {"explicit", {PagePolicy::Explicit, NumaPolicy::FirstTouch, 1}},
+        };
+        for (auto& [name, policy] : policies) {
+            double t0 = nowSeconds();
+            CsrLayout<LargeArray<long long>, LargeArray<int>, LargeArray<array<int, 2>>> csr{
+                LargeArray<long long>(n + 1, policy), LargeArray<int>(m, policy), LargeArray<array<int, 2>>(m, policy)};
+            // Copy in with the fill workers, so FirstTouch pages follow the same split as the worker ranges
+            csr.offset.parallelRanges(fillThreads, [&](size_t lo, size_t hi) { copy(offset.data() + lo, offset.data() + hi, csr.offset.data() + lo); });
+            csr.target.parallelRanges(fillThreads, [&](size_t lo, size_t hi) { copy(target.data() + lo, target.data() + hi, csr.target.data() + lo); });
+            csr.arc.parallelRanges(fillThreads, [&](size_t lo, size_t hi) { copy(arc.data() + lo, arc.data() + hi, csr.arc.data() + lo); });
+            bool bound = csr.offset.usedNumaBinding() && csr.target.usedNumaBinding() && csr.arc.usedNumaBinding();
+            runLayout(name, csr, nowSeconds() - t0, csr.target.usedExplicitHugePages(), bound);
+        }
+
+        // Scratch initialization: one thread filling a vector vs T first-touch workers (the T workers are the
+        // parallelism here); first_touch's speedup is relative to the vector fill at the first thread count
+        volatile int sink = 0;
+        BenchRecord init = rec;
+        init.m = n;
+        init.extra = {{"numa_nodes", (double)numaNodeCount()}};
+        init.algorithm = "scratch_init/vector";
+        double vectorSeconds = measureEngineScaling(opt, init, [&](int) -> vector<pair<string, double>> {
+            vector<int> dist(n, INT_MAX);
+            sink = sink + dist[n / 2];
+            return {};
+        });
+        init.algorithm = "scratch_init/first_touch";
+        measureEngineScaling(opt, init, [&](int T) -> vector<pair<string, double>> {
+            LargeArray<int> dist(n, {PagePolicy::Transparent, NumaPolicy::FirstTouch, 1});
+            dist.firstTouch(T, INT_MAX);
+            sink = sink + dist[n / 2];
+            return {};
+        }, vectorSeconds);
+    }
+    return 0;
+}
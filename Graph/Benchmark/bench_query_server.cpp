@@ -0,0 +1,94 @@
+#include "bench_common.h"
+#include "graph_generators.h"
+#include "../Server/graph_query_server.h"
+
+/*
+    Load generator for Server/graph_query_server.h: QPS scaling of the concurrent query executor.
+
+    For every worker count T in --threads, a GraphQueryServer with T workers serves 4 * T closed-loop clients.
+    Each client repeatedly submits a burst of 16 random queries with submitBatch and waits for all of them, so
+    the server sees a steady backlog without unbounded queueing.
+
+    Query mixes (`algorithm`):
+    - `connected` : Connected(s, t) only, measures executor overhead (the answer is a label lookup).
+    - `hops`      : Hops(s, t), workspace unit-weight BFS.
+    - `distance`  : Distance(s, t), workspace dijkstra.
+    - `mixed`     : 50% connected, 25% hops, 25% distance.
+
+    Extra fields per record:
+    - `qps`, `p50_us`, `p95_us`, `p99_us`, `max_us` : throughput and end-to-end query latency.
+    - `mismatch` : queries whose concurrent answer differs from a sequential SharedGraph::answer.
+    `speedup` is relative to the 1-worker QPS; `edges_per_sec` is not meaningful here and stays 0.
+    Every client issues `--reps * 16` bursts, so --reps scales the run length.
+*/
+
+static vector<Query> makeQueries(const string& mix, int count, int n, mt19937_64& rng) {
+    vector<Query> qs(count);
+    for (auto& q : qs) {
+        int r = rng() % 4;
+        if (mix == "connected") q.kind = QueryKind::Connected;
+        else if (mix == "hops") q.kind = QueryKind::Hops;
+        else if (mix == "distance") q.kind = QueryKind::Distance;
+        else q.kind = r < 2 ? QueryKind::Connected : r == 2 ? QueryKind::Hops : QueryKind::Distance;
+        q.source = rng() % n;
+        q.target = rng() % n;
+    }
+    return qs;
+}
+
+int main(int argc, char** argv) {
+    BenchOptions opt = parseBenchOptions(argc, argv);
+    const int burst = 16;
+
+    for (string gen : {"rmat", "grid", "rgg"}) {
+        if (!opt.wants(gen)) continue;
+        EdgeList g = makeGraph(gen, opt.scale, opt.seed, false);
+        auto graph = make_shared<const SharedGraph>(g.n, toEdgeTriples(g), false);
+
+        for (string mix : {"connected", "hops", "distance", "mixed"}) {
+            double baseQps = 0;
+            for (int T : opt.threads) {
+                int clients = 4 * T, bursts = opt.reps * 16;
+                atomic<long long> mismatches{0};
+                GraphQueryServer server(graph, T);
+
+                // Clients are plain load generators; they only block on futures.
+                vector<thread> pool;
+                for (int c = 0; c < clients; c++) {
+                    pool.emplace_back([&, c] {
+                        mt19937_64 rng(opt.seed * 1000003 + c);
+                        QueryWorkspace<int> ws;
+                        for (int b = 0; b < bursts; b++) {
+                            vector<Query> qs = makeQueries(mix, burst, g.n, rng);
+                            vector<long long> got = server.run(qs);
+                            // Spot-check the first burst of every client against a sequential answer
+                            if (b == 0) {
+                                for (int i = 0; i < burst; i++)
+                                    if (got[i] != graph->answer(qs[i], ws)) mismatches++;
+                            }
+                        }
+                    });
+                }
+                for (auto& t : pool) t.join();
+                ServerStats s = server.stats();
+
+                BenchRecord rec;
+                rec.bench = "query_server";
+                rec.algorithm = mix;
+                rec.generator = gen;
+                rec.n = g.n;
+                rec.m = g.edges.size();
+                rec.threads = T;
+                rec.reps = opt.reps;
+                rec.seconds = s.seconds;
+                if (baseQps == 0) baseQps = s.qps;
+                rec.speedup = baseQps > 0 ? s.qps / baseQps : 1;
+                rec.peakRss = peakRssKb();
+                rec.extra = {{"qps", s.qps}, {"p50_us", s.p50Micros}, {"p95_us", s.p95Micros},
+                             {"p99_us", s.p99Micros}, {"max_us", s.maxMicros}, {"mismatch", (double)mismatches}};
+                rec.print();
+            }
+        }
+    }
+    return 0;
+}
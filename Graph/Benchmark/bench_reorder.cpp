@@ -0,0 +1,170 @@
+#include "bench_common.h"
+#include "graph_generators.h"
+#include "../Reordering/graph_reordering.h"
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/*
+    Node reordering benchmark: the same algorithms on the same graph under different node labelings.
+
+    Labelings (Reordering/graph_reordering.h):
+    - `random`  : a random permutation of the generator ids, standing in for arbitrary input ids.
+    - `degree`, `bfs`, `rcm`, `gorder` : computed from the random labeling.
+
+    Algorithms (the repo implementations, run on the relabeled graph):
+    - `dijkstra` : Shortet_Path/dijkstras_positive_weights.cpp
+    - `unit_bfs` : Shortet_Path/shortest_path_in_undirected_graph_with_unit_weight.cpp
+    - `prim`     : MST/minimam_spaning_tree_weight.cpp (undirected graph) from the same source vertex; `m` counts
+                   the edges of the source's component, the part Prim spans.
+    - `kosaraju` : strongly_connected_componenets.cpp
+
+    Every record carries the labeling name in `algorithm` ("dijkstra/rcm") plus:
+    - `log_gap`      : mean log2(1 + |id(u) - id(v)|) over the edges, a hardware-independent locality score.
+    - `cache_misses` : hardware cache misses of one single-threaded run (Linux perf_event_open), or -1 when the
+                       kernel does not expose hardware counters (containers, perf_event_paranoid > 2, VMs).
+    - `reorder_seconds` : time to compute the labeling.
+
+    Results are mapped back to the original ids and checked against the `random` run (dijkstra / unit_bfs
+    distances, MST weight, SCC count); `mismatch` is 1 if they differ.
+*/
+
+namespace dijkstra_impl {
+#include "../Shortet_Path/dijkstras_positive_weights.cpp"
+}
+namespace unit_bfs_impl {
+#include "../Shortet_Path/shortest_path_in_undirected_graph_with_unit_weight.cpp"
+}
+namespace prim_impl {
+#include "../MST/minimam_spaning_tree_weight.cpp"
+}
+namespace scc_impl {
+#include "../strongly_connected_componenets.cpp"
+}
+
+// Hardware cache misses of fn() on a large-stack worker thread, or -1 if the counter is unavailable.
+static double cacheMisses(const function<void()>& fn) {
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled = 1;
+    attr.inherit = 1;  // Count the worker thread created below
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    int fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+    if (fd < 0) {
+        runThreads(1, [&](int) { fn(); });
+        return -1;
+    }
+    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    runThreads(1, [&](int) { fn(); });
+    ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    long long count = 0;
+    if (read(fd, &count, sizeof(count)) != sizeof(count)) count = -1;
+    close(fd);
+    return count;
+}
+
+int main(int argc, char** argv) {
+    BenchOptions opt = parseBenchOptions(argc, argv);
+
+    for (string gen : {"rmat", "grid", "rgg"}) {
+        if (!opt.wants(gen)) continue;
+        EdgeList g = makeGraph(gen, opt.scale, opt.seed, true);
+
+        // Scramble the generator ids so every labeling starts from arbitrary ids.
+        vector<int> perm(g.n);
+        iota(perm.begin(), perm.end(), 0);
+        shuffle(perm.begin(), perm.end(), mt19937(opt.seed));
+        for (auto& e : g.edges) {
+            e.u = perm[e.u];
+            e.v = perm[e.v];
+        }
+        EdgeList ug = g;
+        ug.directed = false;
+        simplifyEdges(ug);
+
+        auto weightedAdj = toWeightedAdj(g);
+        auto undirectedAdj = toWeightedAdj(ug);
+        auto adjList = toAdjList(g);
+        auto pairs = toEdgePairs(ug);
+        auto nbrs = symmetricNeighbours(adjList);
+        int source = 0;
+        for (int i = 0; i < g.n; i++)
+            if (weightedAdj[i].size() > weightedAdj[source].size()) source = i;
+
+        // Edges of the source's component (every undirected edge appears in two lists)
+        long long componentEdges = 0;
+        vector<char> seen(g.n, 0);
+        vector<int> stack = {source};
+        seen[source] = 1;
+        while (!stack.empty()) {
+            int u = stack.back();
+            stack.pop_back();
+            componentEdges += undirectedAdj[u].size();
+            for (auto& e : undirectedAdj[u])
+                if (!seen[e[0]]) seen[e[0]] = 1, stack.push_back(e[0]);
+        }
+        componentEdges /= 2;
+
+        vector<int> refDist, refHops;
+        int refScc = -1, refMst = -1;
+
+        vector<pair<string, function<Relabeling()>>> orders = {
+            {"random", [&] { return identityOrder(g.n); }},
+            {"degree", [&] { return degreeOrder(nbrs); }},
+            {"bfs", [&] { return bfsOrder(nbrs); }},
+            {"rcm", [&] { return rcmOrder(nbrs); }},
+            {"gorder", [&] { return gorderOrder(nbrs); }},
+        };
+        for (auto& [name, makeOrder] : orders) {
+            double t0 = nowSeconds();
+            Relabeling r = makeOrder();
+            double reorderSeconds = nowSeconds() - t0;
+
+            auto adj2 = r.permuteWeightedAdj(weightedAdj);
+            auto uadj2 = r.permuteWeightedAdj(undirectedAdj);
+            auto list2 = r.permuteAdjList(adjList);
+            auto pairs2 = r.permuteEdges(pairs);
+            int s = r.newId[source];
+            double gap = averageLogGap(nbrs, r);
+
+            BenchRecord rec;
+            rec.bench = "reorder";
+            rec.generator = gen;
+            rec.n = g.n;
+
+            auto runOne = [&](const string& algo, long long m, const function<void()>& kernel, double mismatch) {
+                rec.algorithm = algo + "/" + name;
+                rec.m = m;
+                rec.extra = {{"log_gap", gap}, {"reorder_seconds", reorderSeconds},
+                             {"cache_misses", cacheMisses(kernel)}, {"mismatch", mismatch}};
+                measureScaling(opt, rec, [&](int) { kernel(); });
+            };
+
+            vector<int> dist = r.mapBack(dijkstra_impl::Solution().dijkstra(g.n, adj2.data(), s));
+            if (name == "random") refDist = dist;
+            runOne("dijkstra", g.edges.size(),
+                   [&] { dijkstra_impl::Solution().dijkstra(g.n, adj2.data(), s); }, dist != refDist);
+
+            vector<int> hops = r.mapBack(unit_bfs_impl::Solution().shortestPath(pairs2, g.n, pairs2.size(), s));
+            if (name == "random") refHops = hops;
+            runOne("unit_bfs", pairs.size(),
+                   [&] { unit_bfs_impl::Solution().shortestPath(pairs2, g.n, pairs2.size(), s); }, hops != refHops);
+
+            int mst = prim_impl::spanningTree(g.n, uadj2.data(), s);
+            if (name == "random") refMst = mst;
+            runOne("prim", componentEdges, [&] { prim_impl::spanningTree(g.n, uadj2.data(), s); }, mst != refMst);
+
+            int scc = 0;
+            runThreads(1, [&](int) { scc = scc_impl::solution().kosaraju(g.n, list2); });
+            if (name == "random") refScc = scc;
+            runOne("kosaraju", g.edges.size(), [&] { scc_impl::solution().kosaraju(g.n, list2); }, scc != refScc);
+        }
+    }
+    return 0;
+}
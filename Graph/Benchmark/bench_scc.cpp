@@ -0,0 +1,108 @@
+#include "bench_common.h"
+#include "graph_generators.h"
+
+/*
+    Strongly connected components benchmark.
+
+    Algorithms:
+    - `kosaraju`    : strongly_connected_componenets.cpp (two recursive DFS passes + transpose).
+    - `incremental` : IncrementalScc from the same file, built from the first half of the edges (one kosaraju pass)
+                      and then given the second half one insertEdge at a time.
+                      Extra fields: `mismatch` is 1 if, at any of 8 checkpoints during the insertions,
+                      components(), sameScc() (the node partition) or condensation() (its DAG up to renumbering)
+                      differs from condense() recomputed on the edges so far; `random_mismatch` is the same check
+                      on 400 small random insertion sequences.
+
+    Directed R-MAT gives one giant SCC plus many singletons, randomly oriented grids give many
+    small SCCs, layered DAGs give n singleton components (worst case for the second pass).
+*/
+
+namespace scc_impl {
+#include "../strongly_connected_componenets.cpp"
+}
+
+// Same partition and the same DAG up to renumbering the components.
+static bool sameCondensation(const scc_impl::Condensation& a, const scc_impl::Condensation& b) {
+    if (a.components != b.components) return false;
+    vector<int> toB(a.components, -1);
+    for (size_t v = 0; v < a.component.size(); v++) {
+        int& m = toB[a.component[v]];
+        if (m == -1) m = b.component[v];
+        else if (m != b.component[v]) return false;
+    }
+    auto edges = [](const scc_impl::Condensation& d, const vector<int>& rename) {
+        vector<pair<int, int>> e;
+        for (int c = 0; c < d.components; c++)
+            for (int i = d.offset[c]; i < d.offset[c + 1]; i++) e.push_back({rename[c], rename[d.target[i]]});
+        sort(e.begin(), e.end());
+        return e;
+    };
+    vector<int> identity(b.components);
+    iota(identity.begin(), identity.end(), 0);
+    return edges(a, toB) == edges(b, identity);
+}
+
+// Inserts edges[from..) into `inc` and compares against a full recomputation at `checkpoints` points.
+static bool checkIncremental(int n, const vector<pair<int, int>>& edges, size_t from, int checkpoints) {
+    vector<vector<int>> adj(n);
+    for (size_t i = 0; i < from; i++) adj[edges[i].first].push_back(edges[i].second);
+    scc_impl::IncrementalScc inc(n, adj);
+    size_t step = max<size_t>(1, (edges.size() - from) / checkpoints);
+    for (size_t i = from; i < edges.size(); i++) {
+        inc.insertEdge(edges[i].first, edges[i].second);
+        adj[edges[i].first].push_back(edges[i].second);
+        if ((i - from + 1) % step != 0 && i + 1 != edges.size()) continue;
+        auto full = scc_impl::solution().condense(n, adj);
+        if (inc.components() != full.components || !sameCondensation(inc.condensation(), full)) return false;
+        for (int k = 0; k < 16; k++) {
+            int u = k * 7919 % n, v = k * 104729 % n;
+            if (inc.sameScc(u, v) != (full.component[u] == full.component[v])) return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    BenchOptions opt = parseBenchOptions(argc, argv);
+
+    int randomMismatch = 0;
+    mt19937 rng(opt.seed);
+    for (int iter = 0; iter < 400; iter++) {
+        int n = rng() % 40 + 1, m = rng() % (3 * n);
+        vector<pair<int, int>> small;
+        for (int i = 0; i < m; i++) small.push_back({(int)(rng() % n), (int)(rng() % n)});
+        randomMismatch += !checkIncremental(n, small, rng() % (m + 1), max(1, m));
+    }
+
+    for (string gen : {"rmat", "grid", "dag"}) {
+        if (!opt.wants(gen)) continue;
+        EdgeList g = makeGraph(gen, opt.scale, opt.seed, true);
+        auto adj = toAdjList(g);
+
+        BenchRecord rec;
+        rec.bench = "scc";
+        rec.algorithm = "kosaraju";
+        rec.generator = gen;
+        rec.n = g.n;
+        rec.m = g.edges.size();
+        rec.extra.push_back({"components", (double)scc_impl::solution().kosaraju(g.n, adj)});
+        measureScaling(opt, rec, [&](int) { scc_impl::solution().kosaraju(g.n, adj); });
+
+        // Incremental: first half by kosaraju, second half inserted one edge at a time
+        vector<pair<int, int>> edges;
+        for (auto& e : g.edges) edges.push_back({e.u, e.v});
+        shuffle(edges.begin(), edges.end(), mt19937_64(opt.seed));
+        size_t half = edges.size() / 2;
+        bool mismatch = false;
+        runThreads(1, [&](int) { mismatch = !checkIncremental(g.n, edges, half, 8); });  // Recursive kosaraju
+        rec.algorithm = "incremental";
+        rec.extra = {{"mismatch", (double)mismatch}, {"random_mismatch", (double)randomMismatch}};
+        measureScaling(opt, rec, [&](int) {
+            vector<vector<int>> first(g.n);
+            for (size_t i = 0; i < half; i++) first[edges[i].first].push_back(edges[i].second);
+            scc_impl::IncrementalScc inc(g.n, first);
+            for (size_t i = half; i < edges.size(); i++) inc.insertEdge(edges[i].first, edges[i].second);
+        });
+    }
+    return 0;
+}
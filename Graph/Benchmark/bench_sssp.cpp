@@ -0,0 +1,132 @@
+#include "bench_common.h"
+#include "graph_generators.h"
+
+/*
+    Single-source shortest path benchmark.
+
+    Algorithms (the repo implementations are included verbatim):
+    - `dijkstra`       : Shortet_Path/dijkstras_positive_weights.cpp on rmat, grid and rgg.
+    - `bellman_ford`   : Shortet_Path/bellmonford_negative_weights.cpp, O(V * E), so it runs at scale - 4.
+    - `dag_shortest`   : Shortet_Path/shortest_path_in_directed_acyclic_graph.cpp on layered DAGs.
+    - `small_weight`   : Shortet_Path/small_weight_sssp.cpp (Dial's bucket queue; the generators emit weights
+                         in 1..100) on rmat, grid and rgg.
+    - `unit_bfs`       : Shortet_Path/shortest_path_in_undirected_graph_with_unit_weight.cpp on rmat and grid.
+
+    Worker `tid` uses a different source so the threads do not share a hot frontier.
+    The `checksum` field (sum of reachable distances from worker 0's source) lets two engine
+    variants be compared for correctness as well as speed.
+*/
+
+namespace dijkstra_impl {
+#include "../Shortet_Path/dijkstras_positive_weights.cpp"
+}
+namespace bellman_ford_impl {
+#include "../Shortet_Path/bellmonford_negative_weights.cpp"
+}
+namespace dag_impl {
+#include "../Shortet_Path/shortest_path_in_directed_acyclic_graph.cpp"
+}
+#define main small_weight_demo_main
+namespace small_weight_impl {
+#include "../Shortet_Path/small_weight_sssp.cpp"
+}
+#undef main
+namespace unit_bfs_impl {
+#include "../Shortet_Path/shortest_path_in_undirected_graph_with_unit_weight.cpp"
+}
+
+// Sources are spread over the vertices that have outgoing edges (R-MAT leaves many sinks).
+static vector<int> candidateSources(const EdgeList& g) {
+    vector<char> hasOut(g.n, 0);
+    for (auto& e : g.edges) hasOut[e.u] = 1;
+    vector<int> out;
+    for (int i = 0; i < g.n; i++)
+        if (hasOut[i]) out.push_back(i);
+    if (out.empty()) out.push_back(0);
+    return out;
+}
+
+static int sourceFor(int tid, const vector<int>& sources) {
+    return sources[(1LL * tid * 7919) % sources.size()];
+}
+
+static double checksum(const vector<int>& dist, long long unreachable) {
+    double sum = 0;
+    for (int d : dist)
+        if (d != unreachable && d >= 0) sum += d;
+    return sum;
+}
+
+int main(int argc, char** argv) {
+    BenchOptions opt = parseBenchOptions(argc, argv);
+
+    for (string gen : {"rmat", "grid", "rgg"}) {
+        if (!opt.wants(gen)) continue;
+        EdgeList g = makeGraph(gen, opt.scale, opt.seed, true);
+        auto adj = toWeightedAdj(g);
+        auto sources = candidateSources(g);
+
+        BenchRecord rec;
+        rec.bench = "sssp";
+        rec.algorithm = "dijkstra";
+        rec.generator = gen;
+        rec.n = g.n;
+        rec.m = g.edges.size();
+        rec.extra.push_back({"checksum", checksum(dijkstra_impl::Solution().dijkstra(g.n, adj.data(), sources[0]), INT_MAX)});
+        measureScaling(opt, rec, [&](int tid) {
+            dijkstra_impl::Solution().dijkstra(g.n, adj.data(), sourceFor(tid, sources));
+        });
+
+        rec.algorithm = "small_weight";
+        rec.extra = {{"checksum", checksum(small_weight_impl::SmallWeightSssp().shortestPath(g.n, adj.data(), sources[0]), INT_MAX)}};
+        measureScaling(opt, rec, [&](int tid) {
+            small_weight_impl::SmallWeightSssp().shortestPath(g.n, adj.data(), sourceFor(tid, sources));
+        });
+
+        if (gen != "rgg") {
+            auto pairs = toEdgePairs(g);
+            rec.algorithm = "unit_bfs";
+            rec.extra = {{"checksum", checksum(unit_bfs_impl::Solution().shortestPath(pairs, g.n, pairs.size(), sources[0]), -1)}};
+            measureScaling(opt, rec, [&](int tid) {
+                unit_bfs_impl::Solution().shortestPath(pairs, g.n, pairs.size(), sourceFor(tid, sources));
+            });
+        }
+    }
+
+    // Bellman-Ford is O(V * E); keep it on a smaller instance so the sweep stays in seconds.
+    int bfScale = max(4, opt.scale - 4);
+    for (string gen : {"rmat", "grid"}) {
+        if (!opt.wants(gen)) continue;
+        EdgeList g = makeGraph(gen, bfScale, opt.seed, true);
+        auto triples = toEdgeTriples(g);
+        auto sources = candidateSources(g);
+
+        BenchRecord rec;
+        rec.bench = "sssp";
+        rec.algorithm = "bellman_ford";
+        rec.generator = gen;
+        rec.n = g.n;
+        rec.m = g.edges.size();
+        rec.extra.push_back({"checksum", checksum(bellman_ford_impl::Solution().bellmanFord(g.n, triples, sources[0]), (long long)1e8)});
+        measureScaling(opt, rec, [&](int tid) {
+            bellman_ford_impl::Solution().bellmanFord(g.n, triples, sourceFor(tid, sources));
+        });
+    }
+
+    if (opt.wants("dag")) {
+        EdgeList g = makeGraph("dag", opt.scale, opt.seed, true);
+        auto triples = toEdgeTriples(g);
+
+        BenchRecord rec;
+        rec.bench = "sssp";
+        rec.algorithm = "dag_shortest";
+        rec.generator = "dag";
+        rec.n = g.n;
+        rec.m = g.edges.size();
+        rec.extra.push_back({"checksum", checksum(dag_impl::Solution().shortestPath(g.n, triples.size(), triples), -1)});
+        measureScaling(opt, rec, [&](int) {
+            dag_impl::Solution().shortestPath(g.n, triples.size(), triples);
+        });
+    }
+    return 0;
+}
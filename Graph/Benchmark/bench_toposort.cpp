@@ -0,0 +1,45 @@
+#include "bench_common.h"
+#include "graph_generators.h"
+
+/*
+    Topological sort benchmark.
+
+    Algorithms:
+    - `kahn_bfs` : Topological_Sort/topo_sort_bfs.cpp (indegree + queue).
+    - `dfs`      : Topological_Sort/toposort_dfs.cpp (recursive DFS + stack).
+
+    Inputs are layered DAGs; `layers` controls the depth of the recursion in the DFS variant.
+*/
+
+namespace kahn_impl {
+#include "../Topological_Sort/topo_sort_bfs.cpp"
+}
+namespace topo_dfs_impl {
+#include "../Topological_Sort/toposort_dfs.cpp"
+}
+
+int main(int argc, char** argv) {
+    BenchOptions opt = parseBenchOptions(argc, argv);
+    if (!opt.wants("dag")) return 0;
+
+    int n = 1 << opt.scale;
+    // Shallow-and-wide and deep-and-narrow layerings of the same number of vertices.
+    for (int layers : {max(2, (int)sqrt((double)n)), max(2, n / 16)}) {
+        EdgeList g = dagLayersGraph(layers, max(1, n / layers), 4, opt.seed);
+        auto adj = toAdjList(g);
+
+        BenchRecord rec;
+        rec.bench = "toposort";
+        rec.generator = "dag";
+        rec.n = g.n;
+        rec.m = g.edges.size();
+        rec.extra = {{"layers", (double)layers}};
+
+        rec.algorithm = "kahn_bfs";
+        measureScaling(opt, rec, [&](int) { kahn_impl::Solution().topoSort(g.n, adj.data()); });
+
+        rec.algorithm = "dfs";
+        measureScaling(opt, rec, [&](int) { topo_dfs_impl::topologicalSort(adj); });
+    }
+    return 0;
+}
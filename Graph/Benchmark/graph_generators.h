@@ -0,0 +1,265 @@
+#ifndef GRAPH_BENCHMARK_GRAPH_GENERATORS_H
+#define GRAPH_BENCHMARK_GRAPH_GENERATORS_H
+
+#include <bits/stdc++.h>
+using namespace std;
+
+/*
+    Parameterized synthetic graph generators for the benchmarks.
+
+    Generators:
+    1. **R-MAT / Kronecker** (`rmatGraph`): skewed power-law degrees, small diameter (social / web graphs).
+    2. **2D grid** (`gridGraph`): 4- or 8-connected lattice, large diameter (road networks, meshes).
+    3. **Random geometric** (`randomGeometricGraph`): points in the unit square joined within a radius,
+       weights proportional to distance (sensor / road-like graphs with locality).
+    4. **DAG layers** (`dagLayersGraph`): edges only go from a layer to the next few layers (task graphs).
+    5. **Random raster** (`randomRaster`): 0/1 grids with clustered land for the island problems.
+
+    All graph generators return an `EdgeList` with positive integer weights in [1, maxW], no self loops
+    and no duplicate edges; the converters below produce the exact input formats the
+    algorithms in this repo expect.
+
+    Every generator is deterministic for a given seed.
+*/
+
+struct WeightedEdge {
+    int u, v, w;
+};
+
+struct EdgeList {
+    int n = 0;
+    bool directed = false;
+    vector<WeightedEdge> edges;
+};
+
+// Removes self loops and duplicate edges ({u,v} and {v,u} are the same edge when undirected).
+inline void simplifyEdges(EdgeList& g) {
+    vector<WeightedEdge> out;
+    out.reserve(g.edges.size());
+    for (auto e : g.edges) {
+        if (e.u == e.v) continue;
+        if (!g.directed && e.u > e.v) swap(e.u, e.v);
+        out.push_back(e);
+    }
+    sort(out.begin(), out.end(), [](const WeightedEdge& a, const WeightedEdge& b) {
+        return a.u != b.u ? a.u < b.u : a.v < b.v;
+    });
+    out.erase(unique(out.begin(), out.end(), [](const WeightedEdge& a, const WeightedEdge& b) {
+        return a.u == b.u && a.v == b.v;
+    }), out.end());
+    g.edges.swap(out);
+}
+
+// R-MAT with the Graph500 defaults (a=0.57, b=0.19, c=0.19); vertex ids are shuffled so that
+// the hubs are not all clustered at small ids.
+inline EdgeList rmatGraph(int scale, int edgeFactor, uint64_t seed, bool directed, int maxW = 100,
+                          double a = 0.57, double b = 0.19, double c = 0.19) {
+    mt19937_64 rng(seed);
+    uniform_real_distribution<double> coin(0.0, 1.0);
+    uniform_int_distribution<int> weight(1, maxW);
+
+    EdgeList g;
+    g.n = 1 << scale;
+    g.directed = directed;
+    vector<int> perm(g.n);
+    iota(perm.begin(), perm.end(), 0);
+    shuffle(perm.begin(), perm.end(), rng);
+
+    long long m = (long long)g.n * edgeFactor;
+    g.edges.reserve(m);
+    for (long long i = 0; i < m; i++) {
+        int u = 0, v = 0;
+        for (int bit = 0; bit < scale; bit++) {
+            double r = coin(rng);
+            int du = 0, dv = 0;
+            if (r < a) {}
+            else if (r < a + b) dv = 1;
+            else if (r < a + b + c) du = 1;
+            else du = dv = 1;
+            u |= du << bit;
+            v |= dv << bit;
+        }
+        g.edges.push_back({perm[u], perm[v], weight(rng)});
+    }
+    simplifyEdges(g);
+    return g;
+}
+
+// rows x cols lattice, node id = r * cols + c. When directed, every lattice edge gets a random orientation.
+inline EdgeList gridGraph(int rows, int cols, uint64_t seed, bool directed, bool diagonals = false, int maxW = 100) {
+    mt19937_64 rng(seed);
+    uniform_int_distribution<int> weight(1, maxW);
+    EdgeList g;
+    g.n = rows * cols;
+    g.directed = directed;
+    auto add = [&](int u, int v) {
+        if (directed && (rng() & 1)) swap(u, v);
+        g.edges.push_back({u, v, weight(rng)});
+    };
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            int id = r * cols + c;
+            if (c + 1 < cols) add(id, id + 1);
+            if (r + 1 < rows) add(id, id + cols);
+            if (diagonals && r + 1 < rows && c + 1 < cols) add(id, id + cols + 1);
+            if (diagonals && r + 1 < rows && c > 0) add(id, id + cols - 1);
+        }
+    }
+    return g;
+}
+
+// n points uniformly in the unit square, joined when closer than `radius`; weight = scaled distance.
+// Uses a uniform cell grid so generation is O(n + m) instead of O(n^2).
+inline EdgeList randomGeometricGraph(int n, double radius, uint64_t seed, int maxW = 100) {
+    mt19937_64 rng(seed);
+    uniform_real_distribution<double> coord(0.0, 1.0);
+    vector<double> x(n), y(n);
+    for (int i = 0; i < n; i++) {
+        x[i] = coord(rng);
+        y[i] = coord(rng);
+    }
+
+    int cells = max(1, (int)(1.0 / radius));
+    vector<vector<int>> bucket((size_t)cells * cells);
+    auto cellOf = [&](double v) { return min(cells - 1, (int)(v * cells)); };
+    for (int i = 0; i < n; i++) bucket[(size_t)cellOf(x[i]) * cells + cellOf(y[i])].push_back(i);
+
+    EdgeList g;
+    g.n = n;
+    g.directed = false;
+    for (int i = 0; i < n; i++) {
+        int cx = cellOf(x[i]), cy = cellOf(y[i]);
+        for (int dx = -1; dx <= 1; dx++) {
+            for (int dy = -1; dy <= 1; dy++) {
+                int nx = cx + dx, ny = cy + dy;
+                if (nx < 0 || ny < 0 || nx >= cells || ny >= cells) continue;
+                for (int j : bucket[(size_t)nx * cells + ny]) {
+                    if (j <= i) continue;
+                    double d = hypot(x[i] - x[j], y[i] - y[j]);
+                    if (d <= radius) g.edges.push_back({i, j, max(1, (int)(d / radius * maxW))});
+                }
+            }
+        }
+    }
+    return g;
+}
+
+// `layers` layers of `width` nodes; every node gets `degree` edges into the next `span` layers.
+// Node 0 is in the first layer, so it is a valid source for the DAG shortest path.
+inline EdgeList dagLayersGraph(int layers, int width, int degree, uint64_t seed, int span = 2, int maxW = 100) {
+    mt19937_64 rng(seed);
+    uniform_int_distribution<int> weight(1, maxW);
+    EdgeList g;
+    g.n = layers * width;
+    g.directed = true;
+    for (int l = 0; l + 1 < layers; l++) {
+        int reach = min(span, layers - 1 - l);
+        uniform_int_distribution<int> pickLayer(1, reach);
+        uniform_int_distribution<int> pickNode(0, width - 1);
+        for (int i = 0; i < width; i++) {
+            for (int d = 0; d < degree; d++) {
+                int target = (l + pickLayer(rng)) * width + pickNode(rng);
+                g.edges.push_back({l * width + i, target, weight(rng)});
+            }
+        }
+    }
+    simplifyEdges(g);
+    return g;
+}
+
+// rows x cols 0/1 raster; `density` is the fraction of land seeds, `smoothing` rounds of a majority
+// filter turn the noise into blob-shaped islands of varied sizes.
+inline vector<vector<int>> randomRaster(int rows, int cols, double density, uint64_t seed, int smoothing = 2) {
+    mt19937_64 rng(seed);
+    bernoulli_distribution land(density);
+    vector<vector<int>> grid(rows, vector<int>(cols));
+    for (auto& row : grid)
+        for (auto& cell : row) cell = land(rng);
+    for (int s = 0; s < smoothing; s++) {
+        vector<vector<int>> next = grid;
+        for (int r = 0; r < rows; r++) {
+            for (int c = 0; c < cols; c++) {
+                int cnt = 0;
+                for (int dr = -1; dr <= 1; dr++)
+                    for (int dc = -1; dc <= 1; dc++) {
+                        int nr = r + dr, nc = c + dc;
+                        if (nr >= 0 && nc >= 0 && nr < rows && nc < cols) cnt += grid[nr][nc];
+                    }
+                next[r][c] = cnt >= 5 ? 1 : (cnt <= 3 ? 0 : grid[r][c]);
+            }
+        }
+        grid.swap(next);
+    }
+    return grid;
+}
+
+// Builds the named generator at the requested scale (~2^scale vertices).
+inline EdgeList makeGraph(const string& name, int scale, uint64_t seed, bool directed) {
+    int n = 1 << scale;
+    int side = max(2, (int)sqrt((double)n));
+    if (name == "rmat") return rmatGraph(scale, 8, seed, directed);
+    if (name == "grid") return gridGraph(side, side, seed, directed);
+    if (name == "rgg") {
+        EdgeList g = randomGeometricGraph(n, sqrt(8.0 / (M_PI * n)), seed);
+        if (directed) {
+            // Duplicate every edge in both directions so the geometric graph stays strongly connected per component.
+            size_t m = g.edges.size();
+            for (size_t i = 0; i < m; i++) g.edges.push_back({g.edges[i].v, g.edges[i].u, g.edges[i].w});
+            g.directed = true;
+        }
+        return g;
+    }
+    if (name == "dag") return dagLayersGraph(side, max(1, n / side), 4, seed);
+    cerr << "unknown generator: " << name << endl;
+    exit(2);
+}
+
+// ---- Converters to the input formats used by the algorithms in this repo ----
+
+// adj[u] = {{v, w}, ...}; used by dijkstra and both spanningTree variants.
+inline vector<vector<vector<int>>> toWeightedAdj(const EdgeList& g) {
+    vector<vector<vector<int>>> adj(g.n);
+    for (auto& e : g.edges) {
+        adj[e.u].push_back({e.v, e.w});
+        if (!g.directed) adj[e.v].push_back({e.u, e.w});
+    }
+    return adj;
+}
+
+// adj[u] = {v, ...}; used by kosaraju, topo sort, articulation points.
+inline vector<vector<int>> toAdjList(const EdgeList& g) {
+    vector<vector<int>> adj(g.n);
+    for (auto& e : g.edges) {
+        adj[e.u].push_back(e.v);
+        if (!g.directed) adj[e.v].push_back(e.u);
+    }
+    return adj;
+}
+
+// {{u, v, w}, ...}; used by bellmanFord and the DAG shortest path.
+inline vector<vector<int>> toEdgeTriples(const EdgeList& g) {
+    vector<vector<int>> out;
+    out.reserve(g.edges.size());
+    for (auto& e : g.edges) out.push_back({e.u, e.v, e.w});
+    return out;
+}
+
+// {{u, v}, ...}; used by criticalConnections, the unit-weight BFS and the DSU Solve.
+inline vector<vector<int>> toEdgePairs(const EdgeList& g) {
+    vector<vector<int>> out;
+    out.reserve(g.edges.size());
+    for (auto& e : g.edges) out.push_back({e.u, e.v});
+    return out;
+}
+
+// Dense matrix with -1 for "no edge"; the input format of Floyd-Warshall's shortest_distance.
+inline vector<vector<int>> toAdjMatrix(const EdgeList& g) {
+    vector<vector<int>> mat(g.n, vector<int>(g.n, -1));
+    for (auto& e : g.edges) {
+        mat[e.u][e.v] = e.w;
+        if (!g.directed) mat[e.v][e.u] = e.w;
+    }
+    return mat;
+}
+
+#endif
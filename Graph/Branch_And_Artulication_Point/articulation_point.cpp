@@ -1,3 +1,5 @@
+#include "../Workspace/query_workspace.h"
+
 /*
  * Problem: Find Articulation Points in a Graph.
  * 
@@ -73,6 +75,29 @@ private:
         }
     }
 
+    // Same DFS on stamped workspace arrays: ws.timer / ws.low replace timer / low, "visited" is ws.timer.has(node).
+    void dfs(int node, int parent, vector<int> adj[], QueryWorkspace<int>& ws, vector<int>& ans) {
+        ws.timer.set(node, timerr);
+        ws.low.set(node, timerr);
+        timerr++;
+        int child = 0;
+        bool isAp = false;
+
+        for (auto it : adj[node]) {
+            if (it == parent) continue;
+            if (!ws.timer.has(it)) {
+                dfs(it, node, adj, ws, ans);
+                ws.low.set(node, min(ws.low.get(node), ws.low.get(it)));
+                if (ws.low.get(it) >= ws.timer.get(node) && parent != -1) isAp = true;
+                child++;
+            } else {
+                ws.low.set(node, min(ws.low.get(node), ws.timer.get(it)));
+            }
+        }
+        if (child > 1 && parent == -1) isAp = true;
+        if (isAp) ans.push_back(node);
+    }
+
 public:
     // Function to find all articulation points in the graph
     vector<int> articulationPoints(int n, vector<int> adj[]) {
@@ -101,4 +126,16 @@ public:
         
         return ans;  // Return the list of articulation points
     }
+
+    // Workspace variant (see Workspace/query_workspace.h): articulation points of the connected component of `root`
+    // only, in increasing order ({-1} if none), without any O(n) initialization. Cost: O(component nodes + edges).
+    vector<int> articulationPoints(int n, vector<int> adj[], int root, QueryWorkspace<int>& ws) {
+        ws.begin(n, 0);
+        timerr = 0;
+        vector<int> ans;
+        dfs(root, -1, adj, ws, ans);
+        if (ans.empty()) return {-1};
+        sort(ans.begin(), ans.end());
+        return ans;
+    }
 };
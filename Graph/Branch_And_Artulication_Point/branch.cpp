@@ -1,3 +1,5 @@
+#include "../Workspace/query_workspace.h"
+
 /*
  * Problem: Find Critical Connections in a Network (Bridges in an Undirected Graph).
  * 
@@ -68,6 +70,25 @@ private:
         }
     }
 
+    // Same DFS on stamped workspace arrays: ws.timer / ws.low replace time / low, "visited" is ws.timer.has(node).
+    void dfs(int node, int parent, vector<int> adj[], QueryWorkspace<int>& ws, vector<vector<int>>& bridge) {
+        ws.timer.set(node, timer);
+        ws.low.set(node, timer);
+        timer++;
+
+        for (auto it : adj[node]) {
+            if (it == parent) continue;
+            if (!ws.timer.has(it)) {
+                dfs(it, node, adj, ws, bridge);
+                ws.low.set(node, min(ws.low.get(node), ws.low.get(it)));
+                if (ws.low.get(it) > ws.timer.get(node)) bridge.push_back({node, it});
+            }
+            else {
+                ws.low.set(node, min(ws.low.get(node), ws.timer.get(it)));
+            }
+        }
+    }
+
 public:
     // Function to find all critical connections (bridges) in the graph
     vector<vector<int>> criticalConnections(int n, vector<vector<int>>& connections) {
@@ -89,4 +110,15 @@ public:
         
         return bridge;  // Return the list of critical connections (bridges)
     }
+
+    // Workspace variant (see Workspace/query_workspace.h): takes the prebuilt adjacency list instead of the edge list
+    // and finds the bridges of the connected component of `root` without any O(n) initialization.
+    // Cost: O(component nodes + edges).
+    vector<vector<int>> criticalConnections(int n, vector<int> adj[], int root, QueryWorkspace<int>& ws) {
+        ws.begin(n, 0);
+        timer = 0;
+        vector<vector<int>> bridge;
+        dfs(root, -1, adj, ws, bridge);
+        return bridge;
+    }
 };
@@ -0,0 +1,260 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+#define main biconnectivity_demo_main
+#include "parallel_biconnectivity.cpp"
+#undef main
+
+/*
+ * Problem: "If edge e (or vertex x) fails, are u and v still connected?" for many (failure, u, v) scenarios, without
+ * rerunning criticalConnections / articulationPoints once per scenario.
+ *
+ * Approach: one ParallelBiconnectivity decomposition, then every query is a few array lookups.
+ *
+ * 1. **Edge failure** (`connectedWithoutEdge`):
+ *    - Only a bridge can disconnect anything, and every bridge is a spanning-tree edge {parent(c), c}.
+ *    - Removing it splits c's subtree from the rest of its component, so u and v are separated iff exactly one of
+ *      them lies in the subtree of c: two preorder interval checks. **O(1)**.
+ *
+ * 2. **Vertex failure** (`connectedWithoutVertex`) on the **block-cut tree**:
+ *    - One node per biconnected block, one per articulation point, one per isolated vertex; a cut node is linked to
+ *      every block it belongs to. A non-cut vertex is represented by its (single) block.
+ *    - Removing a non-articulation vertex x never disconnects two other vertices. Removing an articulation point x
+ *      separates u and v iff cut node x lies on the tree path between their nodes a and b.
+ *    - With the tree rooted and numbered in preorder: if exactly one of a, b is below x, x is on the path; if both are,
+ *      x is on the path iff it is their LCA, i.e. they hang below different children of x. The child containing a node
+ *      is a binary search over x's children by preorder, so this LCA-at-x test needs no O(n log n) LCA table.
+ *      **O(log deg(x))**, O(1) for every other case.
+ *
+ * Edges are identified by their index in the input list (parallel edges and self-loops allowed). u == x or v == x
+ * counts as disconnected: the failed vertex itself is gone.
+ *
+ * Time Complexity:
+ * - Build: the ParallelBiconnectivity pass plus **O(V + E)** for the block-cut tree.
+ * - Query: **O(1)** for edges, **O(log V)** worst case for vertices.
+ *
+ * Space Complexity:
+ * - **O(V + E)**; the block-cut tree has at most 2V nodes.
+ */
+
+class FailureConnectivityOracle {
+public:
+    // edges = {{u, v}, ...}, undirected.
+    FailureConnectivityOracle(int nodes, const vector<vector<int>>& edges, int threads = 1)
+        : n(nodes), edgeList(endpoints(edges)), bcc(nodes, edges, threads) {
+        buildBlockCutTree();
+    }
+
+    bool connected(int u, int v) const { return bcc.componentOf(u) == bcc.componentOf(v); }
+
+    // Are u and v connected once input edge e is removed?
+    bool connectedWithoutEdge(int e, int u, int v) const {
+        if (!connected(u, v)) return false;
+        int a = edgeList[e][0], b = edgeList[e][1];
+        int c = bcc.parentEdgeOf(a) == e ? a : bcc.parentEdgeOf(b) == e ? b : -1;
+        if (c == -1 || !bcc.isBridgeBelow(c)) return true;  // Non-tree edge or tree edge inside a cycle
+        return bcc.isAncestor(c, u) == bcc.isAncestor(c, v);
+    }
+
+    // Are u and v connected once vertex x (and all its edges) is removed?
+    bool connectedWithoutVertex(int x, int u, int v) const {
+        if (u == x || v == x || !connected(u, v)) return false;
+        if (!bcc.isArticulation(x)) return true;
+        int a = vertexNode[u], b = vertexNode[v], c = vertexNode[x];
+        bool belowA = inSubtree(c, a), belowB = inSubtree(c, b);
+        if (belowA != belowB) return false;
+        if (!belowA) return true;                           // Path runs above x
+        return childContaining(c, a) == childContaining(c, b);
+    }
+
+    int blockCutTreeSize() const { return treeNodes; }
+
+private:
+    void buildBlockCutTree() {
+        // Compact the block labels (vertex ids of the block DSU roots) into tree node ids
+        vector<int> blockNode(n, -1);
+        treeNodes = 0;
+        for (size_t e = 0; e < edgeList.size(); e++) {
+            int label = bcc.blockOfEdge(e);
+            if (label != -1 && blockNode[label] == -1) blockNode[label] = treeNodes++;
+        }
+
+        // Incident blocks of every vertex; a cut vertex gets its own node linked to each of them
+        vector<int> incidentOffset(n + 1, 0), incident;
+        for (auto& e : edgeList) {
+            if (e[0] == e[1]) continue;
+            incidentOffset[e[0] + 1]++;
+            incidentOffset[e[1] + 1]++;
+        }
+        for (int v = 0; v < n; v++) incidentOffset[v + 1] += incidentOffset[v];
+        incident.resize(incidentOffset[n]);
+        vector<int> fill(incidentOffset.begin(), incidentOffset.end() - 1);
+        for (size_t e = 0; e < edgeList.size(); e++) {
+            int label = bcc.blockOfEdge(e);
+            if (label == -1) continue;
+            incident[fill[edgeList[e][0]]++] = blockNode[label];
+            incident[fill[edgeList[e][1]]++] = blockNode[label];
+        }
+
+        vertexNode.assign(n, -1);
+        vector<pair<int, int>> links;  // {cut node, block node}
+        for (int v = 0; v < n; v++) {
+            auto first = incident.begin() + incidentOffset[v], last = incident.begin() + incidentOffset[v + 1];
+            if (first == last) {
+                vertexNode[v] = treeNodes++;  // Isolated (or only self-loops)
+            } else if (!bcc.isArticulation(v)) {
+                vertexNode[v] = *first;       // All edges of a non-cut vertex lie in one block
+            } else {
+                vertexNode[v] = treeNodes++;
+                sort(first, last);
+                for (auto it = first; it != last; ++it)
+                    if (it == first || *it != *prev(it)) links.push_back({vertexNode[v], *it});
+            }
+        }
+
+        vector<int> adjOffset(treeNodes + 1, 0), adj(2 * links.size());
+        for (auto& l : links) {
+            adjOffset[l.first + 1]++;
+            adjOffset[l.second + 1]++;
+        }
+        for (int x = 0; x < treeNodes; x++) adjOffset[x + 1] += adjOffset[x];
+        vector<int> pos(adjOffset.begin(), adjOffset.end() - 1);
+        for (auto& l : links) {
+            adj[pos[l.first]++] = l.second;
+            adj[pos[l.second]++] = l.first;
+        }
+
+        // Iterative DFS over the forest: preorder numbers and subtree sizes
+        pre.assign(treeNodes, -1);
+        size.assign(treeNodes, 1);
+        vector<int> parent(treeNodes, -1), order, stack;
+        order.reserve(treeNodes);
+        for (int root = 0; root < treeNodes; root++) {
+            if (pre[root] != -1) continue;
+            stack.push_back(root);
+            while (!stack.empty()) {
+                int x = stack.back();
+                stack.pop_back();
+                pre[x] = order.size();
+                order.push_back(x);
+                for (int k = adjOffset[x]; k < adjOffset[x + 1]; k++) {
+                    int y = adj[k];
+                    if (pre[y] == -1) {
+                        parent[y] = x;
+                        stack.push_back(y);
+                    }
+                }
+            }
+        }
+        for (int i = treeNodes - 1; i > 0; i--) {
+            int x = order[i];
+            if (parent[x] != -1) size[parent[x]] += size[x];
+        }
+
+        // Children of every node in preorder (scanning in preorder keeps each list sorted)
+        childOffset.assign(treeNodes + 1, 0);
+        for (int x = 0; x < treeNodes; x++)
+            if (parent[x] != -1) childOffset[parent[x] + 1]++;
+        for (int x = 0; x < treeNodes; x++) childOffset[x + 1] += childOffset[x];
+        childPre.resize(childOffset[treeNodes]);
+        vector<int> next(childOffset.begin(), childOffset.end() - 1);
+        for (int x : order)
+            if (parent[x] != -1) childPre[next[parent[x]]++] = pre[x];
+    }
+
+    // Flat copy of the input endpoints: 8 bytes per edge instead of a heap vector each.
+    static vector<array<int, 2>> endpoints(const vector<vector<int>>& edges) {
+        vector<array<int, 2>> flat(edges.size());
+        for (size_t e = 0; e < edges.size(); e++) flat[e] = {edges[e][0], edges[e][1]};
+        return flat;
+    }
+
+    bool inSubtree(int c, int a) const { return pre[c] < pre[a] && pre[a] < pre[c] + size[c]; }
+
+    // Preorder number of the child of c whose subtree holds a (a strictly below c).
+    int childContaining(int c, int a) const {
+        auto first = childPre.begin() + childOffset[c], last = childPre.begin() + childOffset[c + 1];
+        return *prev(upper_bound(first, last, pre[a]));
+    }
+
+    int n, treeNodes;
+    vector<array<int, 2>> edgeList;  // Input edge e = {u, v}
+    ParallelBiconnectivity bcc;
+    vector<int> vertexNode;          // Block-cut tree node of every vertex
+    vector<int> pre, size;           // Block-cut tree preorder and subtree sizes
+    vector<int> childOffset, childPre;
+};
+
+int main() {
+    // 1. Exhaustive cross-check against a BFS with the failed edge / vertex removed
+    mt19937 rng(44);
+    auto reachable = [](int n, const vector<vector<int>>& edges, int skipEdge, int skipVertex, int src) {
+        vector<vector<int>> adj(n);
+        for (size_t e = 0; e < edges.size(); e++) {
+            if ((int)e == skipEdge || edges[e][0] == skipVertex || edges[e][1] == skipVertex) continue;
+            adj[edges[e][0]].push_back(edges[e][1]);
+            adj[edges[e][1]].push_back(edges[e][0]);
+        }
+        vector<char> seen(n, 0);
+        if (src == skipVertex) return seen;
+        queue<int> q;
+        q.push(src);
+        seen[src] = 1;
+        while (!q.empty()) {
+            int u = q.front();
+            q.pop();
+            for (int v : adj[u])
+                if (!seen[v]) seen[v] = 1, q.push(v);
+        }
+        return seen;
+    };
+
+    long long checked = 0, mismatches = 0;
+    for (int iter = 0; iter < 200; iter++) {
+        int n = rng() % 25 + 1, m = rng() % (2 * n);
+        vector<vector<int>> edges;
+        for (int i = 0; i < m; i++) edges.push_back({(int)(rng() % n), (int)(rng() % n)});  // Loops and multi-edges
+        FailureConnectivityOracle oracle(n, edges, iter % 2 ? 4 : 1);
+        for (int e = 0; e < m; e++) {
+            for (int u = 0; u < n; u++) {
+                vector<char> seen = reachable(n, edges, e, -1, u);
+                for (int v = 0; v < n; v++, checked++)
+                    if (oracle.connectedWithoutEdge(e, u, v) != (bool)seen[v]) mismatches++;
+            }
+        }
+        for (int x = 0; x < n; x++) {
+            for (int u = 0; u < n; u++) {
+                vector<char> seen = reachable(n, edges, -1, x, u);
+                for (int v = 0; v < n; v++, checked++)
+                    if (oracle.connectedWithoutVertex(x, u, v) != (bool)seen[v]) mismatches++;
+            }
+        }
+    }
+    cout << "Random graphs: " << checked << " queries, mismatches: " << mismatches << endl;
+
+    // 2. Build time and query throughput on a large sparse graph (many bridges and cut vertices)
+    int n = 1 << 20;
+    vector<vector<int>> edges;
+    for (int v = 1; v < n; v++) edges.push_back({v, (int)(rng() % v)});
+    for (int i = 0; i < n / 2; i++) edges.push_back({(int)(rng() % n), (int)(rng() % n)});
+    auto t0 = chrono::steady_clock::now();
+    FailureConnectivityOracle oracle(n, edges, max(1u, thread::hardware_concurrency()));
+    double build = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+
+    int queries = 10000000;
+    vector<array<int, 3>> scenarios(queries);
+    for (auto& s : scenarios) s = {(int)(rng() % n), (int)(rng() % n), (int)(rng() % n)};
+    long long disconnected = 0;
+    t0 = chrono::steady_clock::now();
+    for (auto& s : scenarios) disconnected += !oracle.connectedWithoutEdge(s[0] % edges.size(), s[1], s[2]);
+    double edgeSecs = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+    t0 = chrono::steady_clock::now();
+    for (auto& s : scenarios) disconnected += !oracle.connectedWithoutVertex(s[0], s[1], s[2]);
+    double vertexSecs = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+
+    cout << "n = " << n << ", m = " << edges.size() << ", block-cut tree nodes: " << oracle.blockCutTreeSize()
+         << ", build " << build << " s" << endl;
+    cout << "Edge failures: " << queries / edgeSecs / 1e6 << " M queries/s, vertex failures: "
+         << queries / vertexSecs / 1e6 << " M queries/s (" << disconnected << " disconnected)" << endl;
+    return 0;
+}
@@ -0,0 +1,375 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+#include "../Workspace/query_workspace.h"
+namespace bridge_impl {
+#include "branch.cpp"
+}
+namespace ap_impl {
+#include "articulation_point.cpp"
+}
+
+/*
+ * Problem: Bridges and articulation points of graphs too large for the sequential depth-first low-link DFS in
+ * branch.cpp / articulation_point.cpp (DFS order is inherently sequential).
+ *
+ * Approach (Tarjan-Vishkin biconnectivity, which works with any spanning tree instead of a DFS tree):
+ * 1. **CSR** of the undirected edge list, each edge keeping its id (parallel edges stay distinguishable).
+ *
+ * 2. **Parallel BFS spanning forest**:
+ *    - Level-synchronous BFS, the frontier split over the threads; a vertex is claimed with a CAS on its `claim` slot.
+ *    - The frontiers of all components are stored per depth, which gives the level order used below.
+ *
+ * 3. **Preorder numbering** (instead of an Euler tour + list ranking, the same numbers from two level sweeps):
+ *    - Bottom-up over the levels: `size[v]` = 1 + sizes of its tree children.
+ *    - Top-down: children of v get consecutive preorder ranges starting at pre[v] + 1.
+ *    - Subtree of v = preorder interval [pre[v], pre[v] + size[v]).
+ *
+ * 4. **low / high** (bottom-up, parallel per level): the smallest / largest preorder number reachable from the
+ *    subtree of v with one non-tree edge (the edge to v's parent excluded).
+ *
+ * 5. **Bridges**: tree edge (p, v) is a bridge iff no non-tree edge leaves v's subtree:
+ *    low[v] >= pre[v] and high[v] < pre[v] + size[v].
+ *
+ * 6. **Articulation points** via connectivity on the auxiliary graph whose vertices are the tree edges
+ *    (tree edge (p(v), v) is named by v), with a lock-free union-find:
+ *    - Non-tree edge (u, w) with neither an ancestor of the other: union(u, w).
+ *    - Tree edge (p, v) with p not a root: if low[v] < pre[p] or high[v] >= pre[p] + size[p], union(v, p).
+ *    Components are the biconnected blocks (a non-tree edge belongs to the block of its lower endpoint's tree
+ *    edge). A vertex is an articulation point iff its incident tree edges lie in two or more blocks.
+ *
+ * Output: the same lists as the sequential routines (bridges as {parent, child} pairs in tree order, articulation
+ * points in increasing order, {-1} when there are none), for every component of the graph. The decomposition
+ * itself (spanning forest intervals, bridge flags, block of every edge) stays queryable for
+ * failure_connectivity_oracle.cpp.
+ *
+ * Time Complexity:
+ * - **O((V + E) / T + D)** per phase with T threads and D the number of BFS levels (near-linear work overall).
+ *
+ * Space Complexity:
+ * - **O(V + E)**.
+ *
+ * Limits: V < 2^31 vertices and E < 2^31 edges (vertex and edge ids are int). The CSR holds 2E entries behind 64-bit
+ * offsets, so it stays valid past 1.07B edges; it costs 16 bytes per edge (neighbour + edge id, both directions).
+ */
+
+class ParallelBiconnectivity {
+public:
+    // edges = {{u, v}, ...}: the criticalConnections input format.
+    ParallelBiconnectivity(int n, const vector<vector<int>>& edges, int threads) : n(n), T(max(1, threads)) {
+        assert(edges.size() < (size_t)INT_MAX);  // Edge ids are int
+        buildCsr(edges);
+        spanningForest();
+        numberPreorder();
+        lowHigh();
+        findBridges();
+        findArticulationPoints();
+    }
+
+    const vector<vector<int>>& bridges() const { return bridgeList; }
+    const vector<int>& articulationPoints() const { return apList; }
+
+    // Decomposition accessors
+    int componentOf(int v) const { return componentRoot[v]; }
+    bool isAncestor(int a, int b) const { return pre[a] <= pre[b] && pre[b] < pre[a] + subtree[a]; }
+    int parentEdgeOf(int v) const { return parentEdge[v]; }          // Edge id of v's tree edge, -1 for roots
+    bool isBridgeBelow(int v) const { return bridgeChild[v]; }        // Is v's tree edge a bridge?
+    bool isArticulation(int v) const { return apFlag[v]; }
+    int blockOfEdge(int e) const { return edgeBlock[e]; }             // Biconnected block label, -1 for self-loops
+
+private:
+    static constexpr int kSequentialBelow = 2048;  // Ranges smaller than this are not worth a thread
+
+    // fn(i) for i in [0, count), split into T contiguous ranges.
+    template <class Fn>
+    void parallelFor(size_t count, Fn&& fn) {
+        if (T == 1 || count < kSequentialBelow) {
+            for (size_t i = 0; i < count; i++) fn(i);
+            return;
+        }
+        vector<thread> pool;
+        size_t chunk = (count + T - 1) / T;
+        for (int t = 0; t < T; t++) {
+            size_t lo = t * chunk, hi = min(count, lo + chunk);
+            if (lo >= hi) break;
+            pool.emplace_back([&, lo, hi] {
+                for (size_t i = lo; i < hi; i++) fn(i);
+            });
+        }
+        for (auto& th : pool) th.join();
+    }
+
+    void buildCsr(const vector<vector<int>>& edges) {
+        offset.assign(n + 1, 0);
+        edgeBlock.assign(edges.size(), -1);
+        for (auto& e : edges) {
+            if (e[0] == e[1]) continue;  // Self-loops never matter for connectivity
+            offset[e[0] + 1]++;
+            offset[e[1] + 1]++;
+        }
+        for (int v = 0; v < n; v++) offset[v + 1] += offset[v];
+        nbr.resize(offset[n]);
+        edgeId.resize(offset[n]);
+        vector<long long> cursor(offset.begin(), offset.end() - 1);
+        for (size_t i = 0; i < edges.size(); i++) {
+            int u = edges[i][0], v = edges[i][1];
+            if (u == v) continue;
+            nbr[cursor[u]] = v, edgeId[cursor[u]++] = i;
+            nbr[cursor[v]] = u, edgeId[cursor[v]++] = i;
+        }
+    }
+
+    void spanningForest() {
+        vector<atomic<int>> claim(n);
+        for (auto& c : claim) c.store(-1, memory_order_relaxed);
+        parent.assign(n, -1);
+        parentEdge.assign(n, -1);
+        componentRoot.assign(n, -1);
+
+        for (int root = 0; root < n; root++) {
+            if (claim[root].load(memory_order_relaxed) != -1) continue;
+            claim[root].store(root, memory_order_relaxed);
+            componentRoot[root] = root;
+            roots.push_back(root);
+            vector<int> frontier = {root};
+            for (size_t depth = 0; !frontier.empty(); depth++) {
+                if (levels.size() <= depth) levels.emplace_back();
+                levels[depth].insert(levels[depth].end(), frontier.begin(), frontier.end());
+
+                // Each thread expands a slice of the frontier into its own next list
+                int parts = frontier.size() < kSequentialBelow ? 1 : T;
+                vector<vector<int>> next(parts);
+                auto expand = [&](int t) {
+                    size_t chunk = (frontier.size() + parts - 1) / parts;
+                    for (size_t i = t * chunk; i < min(frontier.size(), (t + 1) * chunk); i++) {
+                        int u = frontier[i];
+                        for (long long k = offset[u]; k < offset[u + 1]; k++) {
+                            int v = nbr[k];
+                            int expected = -1;
+                            if (claim[v].load(memory_order_relaxed) == -1 &&
+                                claim[v].compare_exchange_strong(expected, u, memory_order_relaxed)) {
+                                parent[v] = u;
+                                parentEdge[v] = edgeId[k];
+                                componentRoot[v] = root;
+                                next[t].push_back(v);
+                            }
+                        }
+                    }
+                };
+                if (parts == 1) {
+                    expand(0);
+                } else {
+                    vector<thread> pool;
+                    for (int t = 0; t < parts; t++) pool.emplace_back(expand, t);
+                    for (auto& th : pool) th.join();
+                }
+                frontier.clear();
+                for (auto& part : next) frontier.insert(frontier.end(), part.begin(), part.end());
+            }
+        }
+
+        // Tree children in CSR form
+        childOffset.assign(n + 1, 0);
+        for (int v = 0; v < n; v++)
+            if (parent[v] != -1) childOffset[parent[v] + 1]++;
+        for (int v = 0; v < n; v++) childOffset[v + 1] += childOffset[v];
+        children.resize(childOffset[n]);
+        vector<int> cursor(childOffset.begin(), childOffset.end() - 1);
+        for (int v = 0; v < n; v++)
+            if (parent[v] != -1) children[cursor[parent[v]]++] = v;
+    }
+
+    void numberPreorder() {
+        subtree.assign(n, 1);
+        for (int d = (int)levels.size() - 1; d >= 0; d--) {
+            auto& level = levels[d];
+            parallelFor(level.size(), [&](size_t i) {
+                int v = level[i];
+                for (int k = childOffset[v]; k < childOffset[v + 1]; k++) subtree[v] += subtree[children[k]];
+            });
+        }
+
+        pre.assign(n, 0);
+        int next = 0;
+        for (int r : roots) {
+            pre[r] = next;
+            next += subtree[r];
+        }
+        for (auto& level : levels) {
+            parallelFor(level.size(), [&](size_t i) {
+                int v = level[i];
+                int running = pre[v] + 1;
+                for (int k = childOffset[v]; k < childOffset[v + 1]; k++) {
+                    pre[children[k]] = running;
+                    running += subtree[children[k]];
+                }
+            });
+        }
+    }
+
+    void lowHigh() {
+        low.assign(n, 0);
+        high.assign(n, 0);
+        for (int d = (int)levels.size() - 1; d >= 0; d--) {
+            auto& level = levels[d];
+            parallelFor(level.size(), [&](size_t i) {
+                int v = level[i];
+                int lo = pre[v], hi = pre[v];
+                for (long long k = offset[v]; k < offset[v + 1]; k++) {
+                    if (edgeId[k] == parentEdge[v]) continue;  // The tree edge to the parent itself
+                    lo = min(lo, pre[nbr[k]]);
+                    hi = max(hi, pre[nbr[k]]);
+                }
+                for (int k = childOffset[v]; k < childOffset[v + 1]; k++) {
+                    lo = min(lo, low[children[k]]);
+                    hi = max(hi, high[children[k]]);
+                }
+                low[v] = lo;
+                high[v] = hi;
+            });
+        }
+    }
+
+    void findBridges() {
+        // Tree order: walk the levels so the output is deterministic for every thread count
+        bridgeChild.assign(n, 0);
+        for (auto& level : levels) {
+            for (int v : level) {
+                if (parent[v] != -1 && low[v] >= pre[v] && high[v] < pre[v] + subtree[v]) {
+                    bridgeChild[v] = 1;
+                    bridgeList.push_back({parent[v], v});
+                }
+            }
+        }
+    }
+
+    int find(vector<atomic<int>>& link, int x) {
+        while (true) {
+            int p = link[x].load(memory_order_relaxed);
+            if (p == x) return x;
+            int gp = link[p].load(memory_order_relaxed);
+            if (p != gp) link[x].compare_exchange_weak(p, gp, memory_order_relaxed);  // Path halving
+            x = gp;
+        }
+    }
+
+    void unite(vector<atomic<int>>& link, int a, int b) {
+        while (true) {
+            a = find(link, a);
+            b = find(link, b);
+            if (a == b) return;
+            if (a < b) swap(a, b);  // Always link the larger root under the smaller one: no cycles under races
+            int expected = a;
+            if (link[a].compare_exchange_strong(expected, b, memory_order_relaxed)) return;
+        }
+    }
+
+    void findArticulationPoints() {
+        vector<atomic<int>> block(n);
+        for (int v = 0; v < n; v++) block[v].store(v, memory_order_relaxed);
+
+        parallelFor(n, [&](size_t i) {
+            int u = i;
+            // Rule 1: non-tree edges between unrelated vertices (each edge handled from its smaller endpoint)
+            for (long long k = offset[u]; k < offset[u + 1]; k++) {
+                int w = nbr[k];
+                if (w < u || edgeId[k] == parentEdge[u] || edgeId[k] == parentEdge[w]) continue;
+                if (!isAncestor(u, w) && !isAncestor(w, u)) unite(block, u, w);
+            }
+            // Rule 2: tree edge (p, u) joins (parent(p), p) when u's subtree escapes p's subtree
+            int p = parent[u];
+            if (p != -1 && parent[p] != -1 && (low[u] < pre[p] || high[u] >= pre[p] + subtree[p])) unite(block, u, p);
+        });
+
+        vector<char>& ap = apFlag;
+        ap.assign(n, 0);
+        parallelFor(n, [&](size_t i) {
+            int v = i;
+            int first = parent[v] != -1 ? find(block, v) : -1;
+            for (int k = childOffset[v]; k < childOffset[v + 1]; k++) {
+                int b = find(block, children[k]);
+                if (first == -1) first = b;
+                else if (b != first) {
+                    ap[v] = 1;
+                    break;
+                }
+            }
+        });
+        for (int v = 0; v < n; v++)
+            if (ap[v]) apList.push_back(v);
+        if (apList.empty()) apList = {-1};
+
+        // Block of every edge: a tree edge is named by its child, a non-tree edge joins its deeper endpoint's block
+        parallelFor(n, [&](size_t i) {
+            int u = i;
+            for (long long k = offset[u]; k < offset[u + 1]; k++) {
+                int w = nbr[k], e = edgeId[k];
+                if (w < u) continue;  // Written once, from the smaller endpoint
+                int named = parentEdge[w] == e ? w : parentEdge[u] == e ? u : pre[u] > pre[w] ? u : w;
+                edgeBlock[e] = find(block, named);
+            }
+        });
+    }
+
+    int n, T;
+    vector<long long> offset;                        // Undirected CSR with edge ids: 2E entries, 64-bit offsets
+    vector<int> nbr, edgeId;
+    vector<int> parent, parentEdge, roots;           // Spanning forest
+    vector<vector<int>> levels;                      // Vertices by BFS depth (all components)
+    vector<int> childOffset, children;               // Tree children CSR
+    vector<int> subtree, pre, low, high;
+    vector<int> componentRoot;                       // Root of each vertex's spanning tree
+    vector<char> bridgeChild, apFlag;
+    vector<int> edgeBlock;                           // Indexed by input edge id
+    vector<vector<int>> bridgeList;
+    vector<int> apList;
+};
+
+int main() {
+    // 1. Cross-check against the sequential routines on random connected graphs (spanning path + extra edges)
+    mt19937 rng(43);
+    int mismatches = 0;
+    for (int iter = 0; iter < 300; iter++) {
+        int n = rng() % 60 + 2;
+        set<pair<int, int>> seen;
+        vector<vector<int>> edges;
+        auto add = [&](int u, int v) {
+            if (u != v && seen.insert({min(u, v), max(u, v)}).second) edges.push_back({u, v});
+        };
+        for (int v = 1; v < n; v++) add(v, rng() % v);
+        int extra = rng() % n;
+        for (int i = 0; i < extra; i++) add(rng() % n, rng() % n);
+
+        vector<int> adj[n];
+        for (auto& e : edges) {
+            adj[e[0]].push_back(e[1]);
+            adj[e[1]].push_back(e[0]);
+        }
+        auto norm = [](vector<vector<int>> b) {
+            for (auto& e : b) sort(e.begin(), e.end());
+            sort(b.begin(), b.end());
+            return b;
+        };
+        auto expectedBridges = norm(bridge_impl::Solution().criticalConnections(n, edges));
+        auto expectedAp = ap_impl::Solution().articulationPoints(n, adj);
+        for (int threads : {1, 4}) {
+            ParallelBiconnectivity engine(n, edges, threads);
+            if (norm(engine.bridges()) != expectedBridges || engine.articulationPoints() != expectedAp) mismatches++;
+        }
+    }
+    cout << "Random graphs: mismatches: " << mismatches << endl;
+
+    // 2. Timing on a large sparse graph
+    int n = 1 << 20;
+    vector<vector<int>> edges;
+    for (int v = 1; v < n; v++) edges.push_back({v, (int)(rng() % v)});
+    for (int i = 0; i < 2 * n; i++) edges.push_back({(int)(rng() % n), (int)(rng() % n)});
+    for (int threads : {1, (int)max(1u, thread::hardware_concurrency())}) {
+        auto t0 = chrono::steady_clock::now();
+        ParallelBiconnectivity engine(n, edges, threads);
+        double secs = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+        cout << "Threads: " << threads << ", bridges: " << engine.bridges().size()
+             << ", articulation points: " << engine.articulationPoints().size() << ", " << secs << " s" << endl;
+    }
+    return 0;
+}
@@ -1,4 +1,5 @@
 #include <bits/stdc++.h>
+#include "../Instrumentation/graph_counters.h"
 using namespace std;
 
 /*
@@ -27,12 +28,20 @@ using namespace std;
     - We use three arrays: `parent[]`, `size[]`, and optionally `rank[]` (if used). All these arrays are of size **O(N)**.
     - Thus, the space complexity is **O(N)**.
 
+    Instrumentation:
+    - `Counters` is a policy from Instrumentation/graph_counters.h. With the default `NoCounters` every hook
+      compiles away; with `RecordingCounters` the set records find calls, path-length histograms and merges
+      in its public `counters` member.
+
 */
 
+template <class Counters = NoCounters>
 class DisjointSet {
     vector<int> rank, parent, size;  // rank is not used in this code, but it's a common optimization to keep it for future use
 
 public:
+    Counters counters;  // Operation counts (empty when instrumentation is disabled)
+
     // Constructor: Initializes the parent and size arrays
     DisjointSet(int n) {
         // rank.resize(n + 1, 0);
@@ -48,20 +57,38 @@ public:
 
     // Function to find the representative or root of the set that 'node' belongs to
     int findUPar(int node) {
+        counters.count(Counter::FindCall);
+        if constexpr (Counters::enabled) {
+            // Measure the path before compression flattens it
+            int len = 0;
+            for (int cur = node; cur != parent[cur]; cur = parent[cur]) len++;
+            counters.count(Counter::FindPathStep, len);
+            counters.sample(Histogram::FindPathLength, len);
+        }
+        return findRoot(node);
+    }
+
+private:
+    int findRoot(int node) {
         // Path compression optimization: Recursively find the root and make the path shorter
         if (node == parent[node]) 
             return node;
-        return parent[node] = findUPar(parent[node]);
+        return parent[node] = findRoot(parent[node]);
     }
 
+public:
+
     // Union by size: Merge the smaller set into the larger one (to keep the tree shallow)
     void unionBySize(int u, int v) {
+        counters.count(Counter::UnionCall);
+
         // Find the roots of the sets that 'u' and 'v' belong to
         int ulp_u = findUPar(u);
         int ulp_v = findUPar(v);
 
         // If they are already in the same set, no need to union
         if (ulp_u == ulp_v) return;
+        counters.count(Counter::UnionMerge);
 
         // Union by size: Attach the smaller tree to the larger one
         if (size[ulp_u] < size[ulp_v]) {
@@ -1,4 +1,5 @@
 #include <bits/stdc++.h>
+#include "../Instrumentation/graph_counters.h"
 using namespace std;
 
 /*
@@ -36,9 +37,12 @@ using namespace std;
 
 */
 
+// `Counters` is an instrumentation policy (Instrumentation/graph_counters.h); the default compiles away.
+template <class Counters = NoCounters>
 class DisjointSet {
 public:
     vector<int> rank, parent, size;
+    Counters counters;  // Operation counts (empty when instrumentation is disabled)
     
     // Constructor: Initializes the parent, size, and rank arrays
     DisjointSet(int n) {
@@ -55,20 +59,36 @@ public:
 
     // Function to find the representative (root) of the set containing 'node'
     int findUPar(int node) {
+        counters.count(Counter::FindCall);
+        if constexpr (Counters::enabled) {
+            // Measure the path before compression flattens it
+            int len = 0;
+            for (int cur = node; cur != parent[cur]; cur = parent[cur]) len++;
+            counters.count(Counter::FindPathStep, len);
+            counters.sample(Histogram::FindPathLength, len);
+        }
+        return findRoot(node);
+    }
+
+    // Path-compressing root lookup used by findUPar
+    int findRoot(int node) {
         if (node == parent[node]) 
             return node;  // If the node is its own parent, return the node
         // Path Compression: Make each node in the path point directly to the root
-        return parent[node] = findUPar(parent[node]);
+        return parent[node] = findRoot(parent[node]);
     }
 
     // Union by size: Merge the set containing 'u' and 'v' by size
     void unionBySize(int u, int v) {
+        counters.count(Counter::UnionCall);
+
         // Find the representatives (roots) of the sets containing 'u' and 'v'
         int rootU = findUPar(u);
         int rootV = findUPar(v);
 
         // If the sets are already connected (i.e., their representatives are the same), do nothing
         if (rootU == rootV) return;
+        counters.count(Counter::UnionMerge);
 
         // Union by size: Merge the smaller set into the larger one
         if (size[rootU] < size[rootV]) {
@@ -0,0 +1,367 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+#include "../Instrumentation/graph_counters.h"
+// push/pop instead of #undef, so a file including this one can still rename this file's own main
+#pragma push_macro("main")
+#undef main
+#define main solve_demo_main
+namespace solve_impl {
+#include "find_edges_to_connect_graph.cpp"
+}
+#pragma pop_macro("main")
+
+/*
+ * Problem: Connected components (and Solve's "operations needed to connect the graph") of graphs with billions of
+ * edges, where find_edges_to_connect_graph.cpp runs one sequential DisjointSet loop over every edge and then scans
+ * `ds.parent`.
+ *
+ * Approach:
+ * 1. **Shared label array**: comp[v] is a parent pointer like DisjointSet::parent, updated with CAS by all threads.
+ *    Links always point the larger root at the smaller one, so every tree is rooted at its smallest vertex and the
+ *    final labels are deterministic (independent of thread count and timing).
+ *
+ * 2. **Afforest** (neighbour sampling, adjacency input through `fromGraph`):
+ *    - Rounds r = 0 .. neighborRounds - 1: every vertex links to its r-th neighbour, then all paths are compressed.
+ *      Two rounds already merge almost all of a giant component while touching 2 edges per vertex.
+ *    - Sample `samples` random labels; the most frequent one is the (likely) giant component.
+ *    - Final phase: every vertex *not* in that component links the rest of its neighbours. Vertices of the giant
+ *      component are skipped with their whole list unread (on power-law and mesh graphs, most of the edges), which
+ *      is correct because every edge leaving it is seen from its other endpoint.
+ *
+ * 3. **Edge-list input** (the Solve format): the same two phases without building a CSR (the scatter into
+ *    per-vertex lists costs more than the components themselves). Phase 1 links an evenly strided sample of
+ *    neighborRounds * n edges, phase 2 the remaining edges; after the compression in between, almost every
+ *    phase-2 edge finds both endpoints already under the same root (counted in `stats().skipped`) and costs two
+ *    reads instead of a CAS.
+ *
+ * 4. **Shiloach-Vishkin** (fallback for adjacency that is not symmetric, e.g. one direction per directed edge,
+ *    where skipping the giant component would miss edges that point into it): repeat { hook: for every edge
+ *    whose endpoints carry different roots, CAS the larger root onto the smaller; shortcut: compress every path }
+ *    until no hook succeeds. Also selectable for any input with `method`.
+ *
+ * 5. **Answers**: `components()` (smallest vertex of each vertex's component), `count()`, and `operationsNeeded()`,
+ *    which is Solve's answer: with C components and E input edges, E - (n - C) edges are redundant, so the answer is
+ *    C - 1 if at least that many are redundant, else -1.
+ *
+ * Billion-edge graphs should come in as adjacency: `fromGraph` accepts any adj[u] ranges (vector<vector<int>>,
+ * CsrRows over LargeArray from Memory/numa_memory.h, CompressedGraph, GridGraph).
+ *
+ * Time Complexity:
+ * - Afforest: O(n * neighborRounds + edges outside the giant component) link attempts, near-linear work overall,
+ *   split over T threads with dynamic chunks (skewed degrees balance out).
+ * - Edge list: O(E) with T threads. Shiloach-Vishkin: O(E) per round, O(log n) rounds in practice.
+ *
+ * Space Complexity:
+ * - **O(V)** labels; the input is only read.
+ */
+
+enum class ComponentsMethod { Auto, Afforest, ShiloachVishkin };
+
+struct ComponentsOptions {
+    ComponentsMethod method = ComponentsMethod::Auto;
+    bool symmetric = true;   // fromGraph: adj[u] holds v whenever adj[v] holds u (Auto uses Afforest only then)
+    int neighborRounds = 2;  // Afforest: neighbours (edges per vertex) linked before sampling
+    int samples = 1024;      // Afforest: labels sampled to find the giant component
+};
+
+class ParallelConnectedComponents {
+public:
+    using Method = ComponentsMethod;
+    using Options = ComponentsOptions;
+
+    struct Stats {
+        Method method = Method::Afforest;  // What actually ran
+        int rounds = 0;                    // Afforest: sampling rounds; Shiloach-Vishkin: hook + shortcut rounds
+        double giantFraction = 0;          // Share of the samples in the largest sampled component
+        long long skipped = 0;             // Afforest: vertices (adjacency) or edges (edge list) inside it, not linked
+        double seconds = 0;
+    };
+
+    // edges = {{u, v}, ...}: the Solve input format.
+    ParallelConnectedComponents(int n, const vector<vector<int>>& edges, int threads, Options options = {})
+        : ParallelConnectedComponents(n, threads, options) {
+        auto t0 = chrono::steady_clock::now();
+        edgeCount = edges.size();
+        if (opt.method == Method::ShiloachVishkin)
+            shiloachVishkin(edges.size(), [&](size_t i, auto&& hook) { hook(edges[i][0], edges[i][1]); });
+        else
+            afforestEdges(edges);
+        finish(t0);
+    }
+
+    // Any adj[u] ranges; E (for operationsNeeded) counts each edge once: symmetric lists hold an edge {u, v} in both
+    // lists and a self-loop once, non-symmetric lists hold every edge once.
+    template <class Graph>
+    static ParallelConnectedComponents fromGraph(int n, const Graph& adj, int threads, Options options = {}) {
+        ParallelConnectedComponents cc(n, threads, options);
+        auto t0 = chrono::steady_clock::now();
+        bool sv = options.method == Method::ShiloachVishkin || (options.method == Method::Auto && !options.symmetric);
+        if (sv) {
+            cc.shiloachVishkin(n, [&](size_t u, auto&& hook) {
+                for (int v : adj[u]) hook(u, v);
+            });
+        } else {
+            if (!options.symmetric) cc.opt.samples = 0;  // Forced Afforest: no skipping without symmetry
+            cc.afforest(adj);
+        }
+        // Symmetric lists hold an edge twice but a self-loop once
+        long long entries = 0, loops = 0;
+        for (int u = 0; u < n; u++) {
+            entries += adj[u].size();
+            if (options.symmetric)
+                for (int v : adj[u]) loops += v == u;
+        }
+        cc.edgeCount = options.symmetric ? (entries - loops) / 2 + loops : entries;
+        cc.finish(t0);
+        return cc;
+    }
+
+    const vector<int>& components() const { return label; }  // Smallest vertex of each vertex's component
+    int componentOf(int v) const { return label[v]; }
+    int count() const { return componentCount; }
+    const Stats& stats() const { return info; }
+
+    // Solve's answer: edges to move so the graph becomes connected, -1 if there are not enough redundant edges.
+    int operationsNeeded() const {
+        long long redundant = edgeCount - (n - componentCount);
+        return redundant >= componentCount - 1 ? componentCount - 1 : -1;
+    }
+
+private:
+    static constexpr int kSequentialBelow = 2048;  // Ranges smaller than this are not worth a thread
+    static constexpr size_t kChunk = 4096;          // Dynamic scheduling grain (vertices or edges)
+
+    ParallelConnectedComponents(int n, int threads, Options options) : n(n), T(max(1, threads)), opt(options), comp(n) {
+        parallelFor(n, [&](size_t v) { comp[v].store(v, memory_order_relaxed); });
+    }
+
+    // fn(i) for i in [0, count); threads take kChunk-sized ranges from a shared counter.
+    template <class Fn>
+    void parallelFor(size_t count, Fn&& fn) {
+        if (T == 1 || count < kSequentialBelow) {
+            for (size_t i = 0; i < count; i++) fn(i);
+            return;
+        }
+        atomic<size_t> next{0};
+        vector<thread> pool;
+        for (int t = 0; t < T; t++) {
+            pool.emplace_back([&] {
+                for (size_t lo; (lo = next.fetch_add(kChunk, memory_order_relaxed)) < count;)
+                    for (size_t i = lo; i < min(count, lo + kChunk); i++) fn(i);
+            });
+        }
+        for (auto& th : pool) th.join();
+    }
+
+    // Merges the trees of u and v, hooking the larger root under the smaller one.
+    void link(int u, int v) {
+        int p1 = comp[u].load(memory_order_relaxed), p2 = comp[v].load(memory_order_relaxed);
+        while (p1 != p2) {
+            int high = max(p1, p2), low = min(p1, p2);
+            int pHigh = comp[high].load(memory_order_relaxed);
+            if (pHigh == low) return;  // Already hooked (by this or another thread)
+            if (pHigh == high && comp[high].compare_exchange_strong(pHigh, low, memory_order_relaxed)) return;
+            // high was not a root (or lost the race): climb one level on both sides and retry
+            p1 = comp[comp[high].load(memory_order_relaxed)].load(memory_order_relaxed);
+            p2 = comp[low].load(memory_order_relaxed);
+        }
+    }
+
+    // Points every vertex directly at its root.
+    void compress() {
+        parallelFor(n, [&](size_t v) {
+            int p = comp[v].load(memory_order_relaxed);
+            while (true) {
+                int gp = comp[p].load(memory_order_relaxed);
+                if (gp == p) break;
+                p = gp;
+            }
+            comp[v].store(p, memory_order_relaxed);
+        });
+    }
+
+    // Most frequent label among `samples` random vertices (-1 without samples), its share in info.giantFraction.
+    int sampleGiant() {
+        if (n == 0 || opt.samples <= 0) return -1;
+        unordered_map<int, int> freq;
+        mt19937 rng(n);
+        for (int i = 0; i < opt.samples; i++) freq[comp[rng() % n].load(memory_order_relaxed)]++;
+        auto best = max_element(freq.begin(), freq.end(), [](auto& a, auto& b) { return a.second < b.second; });
+        info.giantFraction = (double)best->second / opt.samples;
+        return best->first;
+    }
+
+    template <class Graph>
+    void afforest(const Graph& adj) {
+        info.method = Method::Afforest;
+        int rounds = max(0, opt.neighborRounds);
+        for (int r = 0; r < rounds; r++) {
+            parallelFor(n, [&](size_t u) {
+                int i = 0;
+                for (int v : adj[u]) {
+                    if (i++ == r) {
+                        link(u, v);
+                        break;
+                    }
+                }
+            });
+            compress();
+            info.rounds++;
+        }
+
+        int giant = sampleGiant();
+        atomic<long long> skipped{0};
+        parallelFor(n, [&](size_t u) {
+            if (comp[u].load(memory_order_relaxed) == giant) {
+                skipped.fetch_add(1, memory_order_relaxed);
+                return;
+            }
+            int i = 0;
+            for (int v : adj[u])
+                if (i++ >= rounds) link(u, v);
+        });
+        compress();
+        info.skipped = skipped.load();
+    }
+
+    void afforestEdges(const vector<vector<int>>& edges) {
+        info.method = Method::Afforest;
+        size_t m = edges.size(), sample = min(m, (size_t)max(0, opt.neighborRounds) * n);
+        size_t stride = sample ? m / sample : 1;  // Edges stride * i (i < sample) form the sample
+        auto inSample = [&](size_t i) { return i % stride == 0 && i / stride < sample; };
+
+        parallelFor(sample, [&](size_t i) { link(edges[i * stride][0], edges[i * stride][1]); });
+        compress();
+        info.rounds = sample > 0;
+        int giant = sampleGiant();
+
+        // Per-chunk counts, so the hot loop has no shared counter
+        vector<long long> skippedIn((m + kChunk - 1) / kChunk, 0);
+        parallelFor(skippedIn.size(), [&](size_t c) {
+            for (size_t i = c * kChunk; i < min(m, (c + 1) * kChunk); i++) {
+                if (inSample(i)) continue;
+                int u = edges[i][0], v = edges[i][1];
+                int cu = comp[u].load(memory_order_relaxed);
+                if (cu == giant && cu == comp[v].load(memory_order_relaxed)) skippedIn[c]++;
+                else link(u, v);
+            }
+        });
+        compress();
+        info.skipped = accumulate(skippedIn.begin(), skippedIn.end(), 0LL);
+    }
+
+    // forEdges(i, hook) calls hook(u, v) for the edges of work unit i (an edge, or a vertex's list).
+    template <class ForEdges>
+    void shiloachVishkin(size_t units, ForEdges&& forEdges) {
+        info.method = Method::ShiloachVishkin;
+        atomic<bool> changed;
+        do {
+            changed.store(false, memory_order_relaxed);
+            // Hook: labels are roots after the previous shortcut, only a root may be re-pointed
+            parallelFor(units, [&](size_t i) {
+                forEdges(i, [&](int u, int v) {
+                    int cu = comp[u].load(memory_order_relaxed), cv = comp[v].load(memory_order_relaxed);
+                    if (cu == cv) return;
+                    int high = max(cu, cv), low = min(cu, cv);
+                    if (comp[high].compare_exchange_strong(high, low, memory_order_relaxed))
+                        changed.store(true, memory_order_relaxed);
+                });
+            });
+            compress();  // Shortcut
+            info.rounds++;
+        } while (changed.load());
+    }
+
+    void finish(chrono::steady_clock::time_point t0) {
+        label.resize(n);
+        for (int v = 0; v < n; v++) {
+            label[v] = comp[v].load(memory_order_relaxed);
+            componentCount += label[v] == v;
+        }
+        vector<atomic<int>>().swap(comp);
+        info.seconds = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+    }
+
+    int n, T;
+    Options opt;
+    vector<atomic<int>> comp;  // Parent pointers while running
+    vector<int> label;
+    int componentCount = 0;
+    long long edgeCount = 0;
+    Stats info;
+};
+
+int main() {
+    using Method = ComponentsMethod;
+
+    // 1. Cross-check against Solve and a sequential DisjointSet on random graphs with many components
+    mt19937 rng(50);
+    int mismatches = 0;
+    for (int iter = 0; iter < 300; iter++) {
+        int n = rng() % 5000 + 1;
+        int m = rng() % (2 * n);
+        vector<vector<int>> edges;
+        for (int i = 0; i < m; i++) edges.push_back({(int)(rng() % n), (int)(rng() % n)});
+
+        solve_impl::DisjointSet ds(n);
+        for (auto& e : edges) ds.unionBySize(e[0], e[1]);
+        vector<int> smallest(n, INT_MAX), expected(n);
+        for (int v = 0; v < n; v++) smallest[ds.findUPar(v)] = min(smallest[ds.findUPar(v)], v);
+        for (int v = 0; v < n; v++) expected[v] = smallest[ds.findUPar(v)];
+        int operations = solve_impl::Solution().Solve(n, edges);
+
+        vector<vector<int>> adj(n), directed(n);  // Both directions / one direction per edge
+        for (auto& e : edges) {
+            adj[e[0]].push_back(e[1]);
+            if (e[0] != e[1]) adj[e[1]].push_back(e[0]);
+            directed[e[0]].push_back(e[1]);
+        }
+        for (int threads : {1, 4}) {
+            for (Method method : {Method::Auto, Method::Afforest, Method::ShiloachVishkin}) {
+                ComponentsOptions options;
+                options.method = method;
+                ParallelConnectedComponents cc(n, edges, threads, options);
+                if (cc.components() != expected || cc.operationsNeeded() != operations) mismatches++;
+                auto viaGraph = ParallelConnectedComponents::fromGraph(n, adj, threads, options);
+                if (viaGraph.components() != expected || viaGraph.operationsNeeded() != operations) mismatches++;
+                options.symmetric = false;
+                auto viaDirected = ParallelConnectedComponents::fromGraph(n, directed, threads, options);
+                if (viaDirected.components() != expected || viaDirected.operationsNeeded() != operations) mismatches++;
+            }
+        }
+    }
+    // Self-loops are redundant edges for Solve: {0,1}, {1,1}, {2,2} on 4 nodes needs 2 operations
+    vector<vector<int>> loops = {{0, 1}, {1, 1}, {2, 2}}, loopAdj = {{1}, {0, 1}, {2}, {}};
+    if (ParallelConnectedComponents::fromGraph(4, loopAdj, 1).operationsNeeded() != solve_impl::Solution().Solve(4, loops))
+        mismatches++;
+    cout << "Random graphs: mismatches: " << mismatches << endl;
+
+    // 2. Timing on a large graph with a giant component: Solve against both engines
+    int n = 1 << 22;
+    vector<vector<int>> edges;
+    for (int i = 0; i < 4 * n; i++) edges.push_back({(int)(rng() % n), (int)(rng() % n)});
+    auto t0 = chrono::steady_clock::now();
+    int operations = solve_impl::Solution().Solve(n, edges);
+    double solveSecs = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+    cout << "Solve: " << operations << " operations, " << solveSecs << " s" << endl;
+    vector<vector<int>> adj(n);
+    for (auto& e : edges) {
+        adj[e[0]].push_back(e[1]);
+        if (e[0] != e[1]) adj[e[1]].push_back(e[0]);
+    }
+    auto report = [](const string& name, int threads, const ParallelConnectedComponents& cc) {
+        auto& s = cc.stats();
+        cout << name << ", threads: " << threads << ", components: " << cc.count()
+             << ", operations: " << cc.operationsNeeded() << ", rounds: " << s.rounds << ", skipped: " << s.skipped
+             << ", " << s.seconds << " s" << endl;
+    };
+    for (int threads : {1, (int)max(1u, thread::hardware_concurrency())}) {
+        ComponentsOptions options;
+        report("Edge list, Afforest", threads, ParallelConnectedComponents(n, edges, threads, options));
+        report("Adjacency, Afforest", threads, ParallelConnectedComponents::fromGraph(n, adj, threads, options));
+        options.method = Method::ShiloachVishkin;
+        report("Edge list, Shiloach-Vishkin", threads, ParallelConnectedComponents(n, edges, threads, options));
+    }
+    return 0;
+}
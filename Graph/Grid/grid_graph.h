@@ -0,0 +1,238 @@
+#ifndef GRAPH_GRID_GRID_GRAPH_H
+#define GRAPH_GRID_GRID_GRAPH_H
+
+#include <bits/stdc++.h>
+using namespace std;
+
+/*
+    Implicit grid graph over an occupancy raster: neighbours are generated from coordinates, nothing is stored
+    per edge.
+
+    Converting a rows x cols grid to `vector<int> adj[]` costs a vector header per cell plus 4 bytes per
+    neighbour (~40 bytes per open cell on a 4-connected map). GridGraph keeps only:
+
+    1. **Cells**: node id u = r * cols + c. One bit per cell says whether it is open (traversable); blocked cells
+       are isolated nodes (empty `g[u]`), so ids stay dense and every routine can size its arrays with `g.size()`.
+
+    2. **Neighbours**: `g[u]` returns the open 4- or 8-neighbours of u (`GridConnectivity`). The range computes a
+       direction mask once (bounds and occupancy bits of the 4/8 surrounding cells) and the iterator walks its set
+       bits, so `for (int v : g[u])` costs O(degree) with no branches on blocked directions. With Eight, a
+       diagonal step needs its endpoint open only (corner cutting allowed), like the majority filter in
+       Benchmark/graph_generators.h.
+
+    3. **Costs** (optional): `setCosts(cost, straight, diagonal)` stores one byte per cell. Stepping into v costs
+       cost[v] * straight, or cost[v] * diagonal for diagonal steps (e.g. 10 / 14 for octile distances).
+       An empty cost vector makes steps cost `straight` / `diagonal` directly (1 / 1 until setCosts is called).
+       `g.weighted()` is a view whose `[u]` yields {v, w} as array<int, 2>, the dijkstra adjacency format.
+
+    4. **Edges**: `forEachEdge(fn)` calls fn(u, v) once per undirected edge (u < v). It ANDs the occupancy words
+       with themselves shifted by one forward direction at a time, so blocked regions are skipped 64 cells at a
+       time; this is the loop for DisjointSet connectivity.
+
+    Routines templated on the graph type run on it unchanged: the workspace unit-weight BFS, the dijkstra
+    workspace overload and LazyDijkstra (on `g.weighted()`), kosaraju and any `for (u) for (v : g[u])` DisjointSet
+    loop. Benchmark/bench_grid.cpp checks each of them against the materialized adjacency lists.
+
+    Lifetime: ranges and `g.weighted()` only point at the GridGraph, so the grid must outlive every search that
+    uses them. A temporary `g.weighted()` is fine for calls that return before the statement ends (dijkstra), and
+    for LazyDijkstra, which copies views into itself; any other routine that keeps the graph beyond the call needs
+    the view in a named variable that outlives it.
+
+    Usage:
+        GridGraph g(grid, GridConnectivity::Eight);     // grid[r][c] != 0 is open
+        Solution().shortestPath(g.size(), g, g.id(r0, c0), g.id(r1, c1), ws);
+        g.setCosts(terrain, 10, 14);
+        Solution().dijkstra(g.size(), g.weighted(), s, t, wws);
+
+    Memory: 1 bit per cell (+1 byte with costs). Neighbour generation is O(1) per neighbour.
+*/
+
+enum class GridConnectivity { Four = 4, Eight = 8 };
+
+class GridGraph {
+public:
+    // Direction d: {dr, dc}. 0-3 are straight, 4-7 diagonal; 0, 1, 4, 5 point forward (to larger ids).
+    static constexpr int kDr[8] = {0, 1, 0, -1, 1, 1, -1, -1};
+    static constexpr int kDc[8] = {1, 0, -1, 0, 1, -1, 1, -1};
+
+    // Walks the set bits of a direction mask; yields the neighbour id or {id, weight}.
+    template <bool WithWeight>
+    class Iterator {
+    public:
+        using value_type = conditional_t<WithWeight, array<int, 2>, int>;
+        using difference_type = ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+        using iterator_category = forward_iterator_tag;
+
+        Iterator() = default;
+        Iterator(const GridGraph* g, int u, unsigned dirs) : graph(g), node(u), mask(dirs) { load(); }
+
+        // A reference into the iterator, so `for (auto& it : adj[u])` (the dijkstra loop) binds to it.
+        const value_type& operator*() const { return current; }
+        Iterator& operator++() {
+            mask &= mask - 1;
+            load();
+            return *this;
+        }
+        Iterator operator++(int) {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+        bool operator==(const Iterator& o) const { return mask == o.mask; }
+        bool operator!=(const Iterator& o) const { return mask != o.mask; }
+
+    private:
+        void load() {
+            if (!mask) return;
+            int d = __builtin_ctz(mask);
+            int v = node + graph->delta[d];
+            if constexpr (WithWeight) current = {v, graph->stepCost(v, d)};
+            else current = v;
+        }
+
+        const GridGraph* graph = nullptr;
+        int node = 0;
+        unsigned mask = 0;
+        value_type current{};
+    };
+
+    template <bool WithWeight>
+    class Range {
+    public:
+        Range(const GridGraph& g, int u) : graph(&g), node(u), mask(g.directions(u)) {}
+        Iterator<WithWeight> begin() const { return Iterator<WithWeight>(graph, node, mask); }
+        Iterator<WithWeight> end() const { return Iterator<WithWeight>(); }
+        size_t size() const { return __builtin_popcount(mask); }
+        bool empty() const { return mask == 0; }
+
+    private:
+        const GridGraph* graph;
+        int node;
+        unsigned mask;
+    };
+
+    // `view[u]` = weighted neighbours of u, for the routines that iterate {v, w} items.
+    class WeightedView {
+    public:
+        explicit WeightedView(const GridGraph& g) : graph(&g) {}
+        Range<true> operator[](int u) const { return Range<true>(*graph, u); }
+        size_t size() const { return graph->size(); }
+
+    private:
+        const GridGraph* graph;
+    };
+
+    GridGraph() = default;
+
+    // All cells blocked; open them with setOpen.
+    GridGraph(int rows, int cols, GridConnectivity connectivity = GridConnectivity::Four)
+        : nRows(rows), nCols(cols), conn(connectivity) {
+        assert((long long)rows * cols < INT_MAX);
+        bits.assign(((size_t)rows * cols + 63) / 64 + 1, 0);  // +1 word: shifted reads may look one word ahead
+        int step[8] = {1, cols, -1, -cols, cols + 1, cols - 1, 1 - cols, -cols - 1};
+        copy(step, step + 8, delta);
+    }
+
+    // grid[r][c] != 0 is open (the island / occupancy convention of Imp_Questions).
+    explicit GridGraph(const vector<vector<int>>& grid, GridConnectivity connectivity = GridConnectivity::Four)
+        : GridGraph(grid.size(), grid.empty() ? 0 : grid[0].size(), connectivity) {
+        for (int r = 0; r < nRows; r++)
+            for (int c = 0; c < nCols; c++)
+                if (grid[r][c]) setOpen(r, c, true);
+    }
+
+    // One byte per cell (row-major, or empty for uniform costs); straight / diagonal scale steps into a cell.
+    void setCosts(vector<uint8_t> cellCost, int straight = 1, int diagonal = 1) {
+        assert(cellCost.empty() || cellCost.size() == size());
+        cost = move(cellCost);
+        straightScale = straight;
+        diagonalScale = diagonal;
+    }
+
+    void setOpen(int r, int c, bool isOpen) {
+        size_t u = id(r, c);
+        if (isOpen) bits[u >> 6] |= 1ULL << (u & 63);
+        else bits[u >> 6] &= ~(1ULL << (u & 63));
+    }
+
+    int id(int r, int c) const { return r * nCols + c; }
+    int row(int u) const { return u / nCols; }
+    int col(int u) const { return u % nCols; }
+    int rows() const { return nRows; }
+    int cols() const { return nCols; }
+    size_t size() const { return (size_t)nRows * nCols; }
+    bool open(int u) const { return bits[u >> 6] >> (u & 63) & 1; }
+    bool hasCosts() const { return !cost.empty(); }
+
+    Range<false> operator[](int u) const { return Range<false>(*this, u); }
+    Range<true> weighted(int u) const { return Range<true>(*this, u); }
+    WeightedView weighted() const { return WeightedView(*this); }
+    int degree(int u) const { return __builtin_popcount(directions(u)); }
+
+    int openCells() const {
+        long long count = 0;
+        for (uint64_t w : bits) count += __builtin_popcountll(w);
+        return count;
+    }
+
+    // Heap bytes of the representation (occupancy bits + costs).
+    size_t bytes() const { return bits.capacity() * sizeof(uint64_t) + cost.capacity(); }
+
+    // fn(u, v) for every undirected edge between open cells, u < v.
+    template <class Fn>
+    void forEachEdge(Fn&& fn) const {
+        int forward[4] = {0, 1, 4, 5}, used = conn == GridConnectivity::Eight ? 4 : 2;
+        size_t words = (size() + 63) / 64;
+        for (int k = 0; k < used; k++) {
+            int d = forward[k];
+            for (size_t w = 0; w < words; w++) {
+                uint64_t both = bits[w] & wordAt(w * 64 + delta[d]);
+                while (both) {
+                    int u = w * 64 + __builtin_ctzll(both);
+                    both &= both - 1;
+                    int r = u / nCols, c = u - r * nCols;
+                    if (inside(r + kDr[d], c + kDc[d])) fn(u, u + delta[d]);
+                }
+            }
+        }
+    }
+
+private:
+    friend class Iterator<false>;
+    friend class Iterator<true>;
+
+    bool inside(int r, int c) const { return r >= 0 && c >= 0 && r < nRows && c < nCols; }
+
+    // 64 occupancy bits starting at cell `pos` (cells past the end read as blocked).
+    uint64_t wordAt(size_t pos) const {
+        size_t w = pos >> 6, s = pos & 63;
+        if (w + 1 >= bits.size()) return w < bits.size() ? bits[w] >> s : 0;
+        return s ? bits[w] >> s | bits[w + 1] << (64 - s) : bits[w];
+    }
+
+    // Bit d set when the neighbour in direction d exists and is open (none for a blocked u).
+    unsigned directions(int u) const {
+        if (!open(u)) return 0;
+        int r = u / nCols, c = u - r * nCols, count = (int)conn;
+        unsigned mask = 0;
+        for (int d = 0; d < count; d++)
+            if (inside(r + kDr[d], c + kDc[d]) && open(u + delta[d])) mask |= 1u << d;
+        return mask;
+    }
+
+    int stepCost(int v, int d) const {
+        int scale = d < 4 ? straightScale : diagonalScale;
+        return cost.empty() ? scale : cost[v] * scale;
+    }
+
+    int nRows = 0, nCols = 0;
+    GridConnectivity conn = GridConnectivity::Four;
+    int delta[8] = {};            // Id offset of each direction
+    vector<uint64_t> bits;        // Occupancy, bit u = cell u open
+    vector<uint8_t> cost;         // Optional per-cell cost of stepping into the cell
+    int straightScale = 1, diagonalScale = 1;
+};
+
+#endif
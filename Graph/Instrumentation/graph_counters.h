@@ -0,0 +1,189 @@
+#ifndef GRAPH_INSTRUMENTATION_GRAPH_COUNTERS_H
+#define GRAPH_INSTRUMENTATION_GRAPH_COUNTERS_H
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/*
+    Compile-time switchable instrumentation for the hot paths of the graph algorithms.
+
+    The algorithms take a `Counters` policy as a template parameter:
+    - **NoCounters** (the default): every hook is an empty inline function and `enabled` is false,
+      so the instrumented code compiles to exactly the uninstrumented code.
+    - **RecordingCounters**: records operation counts, log2 histograms (e.g. findUPar path lengths,
+      relaxations per Bellman-Ford pass) and phase timings, exportable as JSON or as Chrome trace
+      events (load the file in chrome://tracing or https://ui.perfetto.dev).
+
+    Usage:
+        RecordingCounters rc;
+        Solution().dijkstra(V, adj, S, rc);
+        cout << rc.toJson();
+
+    Hooks that need extra work to compute their argument (e.g. walking a DSU path) are guarded with
+    `if constexpr (Counters::enabled)` at the call site so the work also disappears when disabled.
+
+    A RecordingCounters object is not thread-safe; give each thread its own and `merge` them.
+*/
+
+enum class Counter {
+    HeapPush,          // priority queue pushes (dijkstra, Prim)
+    HeapPop,           // priority queue pops
+    StalePop,          // pops of an entry that was already improved / settled
+    EdgeScan,          // adjacency entries examined
+    Relaxation,        // successful distance improvements
+    WastedRelaxation,  // edges examined in a Bellman-Ford pass that did not improve anything
+    BellmanFordPass,   // full passes over the edge list
+    FindCall,          // DisjointSet::findUPar calls
+    FindPathStep,      // parent hops walked by findUPar before compression
+    UnionCall,         // DisjointSet union calls
+    UnionMerge,        // unions that actually merged two sets
+    MstEdgeAccepted,   // edges added to the spanning tree
+    MstEdgeRejected,   // edges skipped because they would close a cycle
+    DfsVisit,          // vertices visited by a DFS
+    ComponentFound,    // strongly connected components discovered
+    Count_
+};
+
+enum class Histogram {
+    FindPathLength,        // parent hops per findUPar call
+    RelaxationsPerPass,    // successful relaxations per Bellman-Ford pass
+    Count_
+};
+
+inline const char* counterName(Counter c) {
+    static const char* names[] = {
+        "heap_push", "heap_pop", "stale_pop", "edge_scan", "relaxation", "wasted_relaxation",
+        "bellman_ford_pass", "find_call", "find_path_step", "union_call", "union_merge",
+        "mst_edge_accepted", "mst_edge_rejected", "dfs_visit", "component_found"};
+    return names[static_cast<int>(c)];
+}
+
+inline const char* histogramName(Histogram h) {
+    static const char* names[] = {"find_path_length", "relaxations_per_pass"};
+    return names[static_cast<int>(h)];
+}
+
+// Disabled policy: every hook is a no-op the optimizer removes entirely.
+struct NoCounters {
+    static constexpr bool enabled = false;
+    void count(Counter, long long = 1) {}
+    void sample(Histogram, long long) {}
+    void beginPhase(const char*) {}
+    void endPhase() {}
+};
+
+// Recording policy: counts, log2-bucketed histograms and a flat list of timed phases.
+class RecordingCounters {
+public:
+    static constexpr bool enabled = true;
+    static constexpr int kBuckets = 40;  // bucket b holds values in [2^(b-1), 2^b), bucket 0 holds 0
+
+    struct Phase {
+        std::string name;
+        double startUs, durationUs;
+        int depth;
+    };
+
+    RecordingCounters() : origin(std::chrono::steady_clock::now()) {
+        counts.fill(0);
+        for (auto& h : histograms) h.fill(0);
+    }
+
+    void count(Counter c, long long by = 1) { counts[static_cast<int>(c)] += by; }
+
+    void sample(Histogram h, long long value) {
+        int bucket = 0;
+        while (bucket + 1 < kBuckets && (1LL << bucket) <= value) bucket++;
+        histograms[static_cast<int>(h)][bucket]++;
+    }
+
+    void beginPhase(const char* name) {
+        open.push_back(phases.size());
+        phases.push_back({name, nowUs(), 0, (int)open.size() - 1});
+    }
+
+    void endPhase() {
+        if (open.empty()) return;
+        Phase& p = phases[open.back()];
+        p.durationUs = nowUs() - p.startUs;
+        open.pop_back();
+    }
+
+    long long get(Counter c) const { return counts[static_cast<int>(c)]; }
+    const std::vector<Phase>& phaseList() const { return phases; }
+
+    // Adds another thread's counts and histograms (phases are appended as-is).
+    void merge(const RecordingCounters& other) {
+        for (int i = 0; i < (int)Counter::Count_; i++) counts[i] += other.counts[i];
+        for (int h = 0; h < (int)Histogram::Count_; h++)
+            for (int b = 0; b < kBuckets; b++) histograms[h][b] += other.histograms[h][b];
+        phases.insert(phases.end(), other.phases.begin(), other.phases.end());
+    }
+
+    // {"counters":{...},"histograms":{"name":[[upper_bound,count],...]},"phases":[{...}]}
+    std::string toJson() const {
+        std::ostringstream out;
+        out << "{\"counters\":{";
+        for (int i = 0; i < (int)Counter::Count_; i++) {
+            out << (i ? "," : "") << "\"" << counterName(static_cast<Counter>(i)) << "\":" << counts[i];
+        }
+        out << "},\"histograms\":{";
+        for (int h = 0; h < (int)Histogram::Count_; h++) {
+            out << (h ? "," : "") << "\"" << histogramName(static_cast<Histogram>(h)) << "\":[";
+            bool first = true;
+            for (int b = 0; b < kBuckets; b++) {
+                if (!histograms[h][b]) continue;
+                // Bucket b holds values below 2^b.
+                out << (first ? "" : ",") << "[" << (1LL << b) << "," << histograms[h][b] << "]";
+                first = false;
+            }
+            out << "]";
+        }
+        out << "},\"phases\":[";
+        for (size_t i = 0; i < phases.size(); i++) {
+            out << (i ? "," : "") << "{\"name\":\"" << phases[i].name << "\",\"start_us\":" << phases[i].startUs
+                << ",\"duration_us\":" << phases[i].durationUs << ",\"depth\":" << phases[i].depth << "}";
+        }
+        out << "]}";
+        return out.str();
+    }
+
+    // Chrome trace event format: one complete ("X") event per phase plus the final counter values ("C").
+    std::string toChromeTrace(int pid = 1, int tid = 1) const {
+        std::ostringstream out;
+        out << "{\"traceEvents\":[";
+        bool first = true;
+        double end = 0;
+        for (auto& p : phases) {
+            out << (first ? "" : ",") << "{\"name\":\"" << p.name << "\",\"ph\":\"X\",\"ts\":" << p.startUs
+                << ",\"dur\":" << p.durationUs << ",\"pid\":" << pid << ",\"tid\":" << tid << "}";
+            first = false;
+            end = std::max(end, p.startUs + p.durationUs);
+        }
+        for (int i = 0; i < (int)Counter::Count_; i++) {
+            if (!counts[i]) continue;
+            out << (first ? "" : ",") << "{\"name\":\"" << counterName(static_cast<Counter>(i))
+                << "\",\"ph\":\"C\",\"ts\":" << end << ",\"pid\":" << pid << ",\"args\":{\"value\":" << counts[i] << "}}";
+            first = false;
+        }
+        out << "]}";
+        return out.str();
+    }
+
+private:
+    double nowUs() const {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - origin).count();
+    }
+
+    std::chrono::steady_clock::time_point origin;
+    std::array<long long, (int)Counter::Count_> counts;
+    std::array<std::array<long long, kBuckets>, (int)Histogram::Count_> histograms;
+    std::vector<Phase> phases;
+    std::vector<size_t> open;
+};
+
+#endif
@@ -0,0 +1,117 @@
+#include "../Benchmark/bench_common.h"
+#include "../Benchmark/graph_generators.h"
+#include "graph_counters.h"
+
+/*
+    Runs the instrumented algorithms once on a synthetic graph and dumps their counters.
+
+        g++ -O2 -std=c++17 -pthread profile_graph_algorithms.cpp -o profile_graph_algorithms
+        ./profile_graph_algorithms --scale=16 --generator=rmat > profile.json
+        ./profile_graph_algorithms --scale=16 --trace > trace.json   # open in chrome://tracing
+
+    Output (default): one JSON object per algorithm,
+        {"algorithm":"dijkstra","generator":"rmat","n":...,"m":...,"stats":{counters, histograms, phases}}
+    With `--trace`: a single Chrome trace where every algorithm is its own track (tid).
+*/
+
+namespace dijkstra_impl {
+#include "../Shortet_Path/dijkstras_positive_weights.cpp"
+}
+namespace bellman_ford_impl {
+#include "../Shortet_Path/bellmonford_negative_weights.cpp"
+}
+#define main kruskal_demo_main
+namespace kruskal_impl {
+#include "../MST/kruskal's.cpp"
+}
+#undef main
+namespace prim_impl {
+#include "../MST/minimam_spaning_tree_weight.cpp"
+}
+#define main dsu_demo_main
+namespace dsu_impl {
+#include "../Disjoint_Set_Union/disjoint_set_union.cpp"
+}
+#undef main
+namespace scc_impl {
+#include "../strongly_connected_componenets.cpp"
+}
+
+int main(int argc, char** argv) {
+    bool trace = false;
+    vector<char*> rest = {argv[0]};
+    for (int i = 1; i < argc; i++) {
+        if (string(argv[i]) == "--trace") trace = true;
+        else rest.push_back(argv[i]);
+    }
+    BenchOptions opt = parseBenchOptions(rest.size(), rest.data());
+    string gen = opt.generator == "all" ? "rmat" : opt.generator;
+
+    EdgeList directed = makeGraph(gen, opt.scale, opt.seed, true);
+    EdgeList undirected = makeGraph(gen, opt.scale, opt.seed, false);
+    auto weightedAdj = toWeightedAdj(directed);
+    auto undirectedAdj = toWeightedAdj(undirected);
+    auto adjList = toAdjList(directed);
+    // Bellman-Ford is O(V * E); profile it on a smaller instance of the same family.
+    EdgeList small = makeGraph(gen, max(4, opt.scale - 4), opt.seed, true);
+    auto triples = toEdgeTriples(small);
+
+    // Start the SSSP runs from the highest out-degree vertex so they explore the graph (R-MAT has many sinks).
+    int source = 0;
+    for (int i = 0; i < directed.n; i++)
+        if (weightedAdj[i].size() > weightedAdj[source].size()) source = i;
+    int smallSource = 0;
+    for (auto& e : small.edges) smallSource = e.u;
+
+    vector<pair<string, RecordingCounters>> runs;
+    auto record = [&](const string& name, const function<void(RecordingCounters&)>& fn) {
+        runs.push_back({name, RecordingCounters()});
+        // Deep recursion in kosaraju / findUPar: run on a large-stack thread like the benchmarks do.
+        runThreads(1, [&](int) { fn(runs.back().second); });
+    };
+
+    record("dijkstra", [&](RecordingCounters& rc) {
+        dijkstra_impl::Solution().dijkstra(directed.n, weightedAdj.data(), source, rc);
+    });
+    record("bellman_ford", [&](RecordingCounters& rc) {
+        bellman_ford_impl::Solution().bellmanFord(small.n, triples, smallSource, rc);
+    });
+    record("kruskal", [&](RecordingCounters& rc) {
+        vector<vector<int>> mstGraph(undirected.n);
+        kruskal_impl::Solution().spanningTree(undirected.n, undirectedAdj.data(), mstGraph, rc);
+    });
+    record("prim", [&](RecordingCounters& rc) {
+        prim_impl::spanningTree(undirected.n, undirectedAdj.data(), source, rc);  // Node 0 may be isolated
+    });
+    record("disjoint_set", [&](RecordingCounters& rc) {
+        dsu_impl::DisjointSet<RecordingCounters> ds(undirected.n);
+        for (auto& e : undirected.edges) ds.unionBySize(e.u, e.v);
+        rc = ds.counters;
+    });
+    record("kosaraju", [&](RecordingCounters& rc) {
+        scc_impl::solution().kosaraju(directed.n, adjList, rc);
+    });
+
+    if (trace) {
+        // Merge the per-algorithm traces into one file, one track per algorithm.
+        cout << "{\"traceEvents\":[";
+        for (size_t i = 0; i < runs.size(); i++) {
+            string events = runs[i].second.toChromeTrace(1, i + 1);
+            events = events.substr(string("{\"traceEvents\":[").size());
+            events = events.substr(0, events.size() - 2);
+            cout << (i ? "," : "") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << i + 1
+                 << ",\"args\":{\"name\":\"" << runs[i].first << "\"}}";
+            if (!events.empty()) cout << "," << events;
+        }
+        cout << "]}" << endl;
+        return 0;
+    }
+
+    for (auto& run : runs) {
+        const EdgeList& g = run.first == "bellman_ford" ? small
+                          : (run.first == "dijkstra" || run.first == "kosaraju") ? directed : undirected;
+        cout << "{\"algorithm\":\"" << run.first << "\",\"generator\":\"" << gen << "\",\"n\":" << g.n
+             << ",\"m\":" << g.edges.size() << ",\"stats\":" << run.second.toJson() << "}" << endl;
+    }
+    return 0;
+}
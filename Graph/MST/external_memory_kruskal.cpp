@@ -0,0 +1,340 @@
+#include <bits/stdc++.h>
+#include <unistd.h>
+using namespace std;
+
+#include "../Instrumentation/graph_counters.h"
+#include "../Weights/weight_traits.h"
+#define main kruskal_demo_main
+namespace kruskal_impl {
+#include "kruskal's.cpp"
+}
+#undef main
+
+/*
+ * Problem: Minimum spanning forest of an undirected edge list far larger than RAM. Solution::spanningTree needs the
+ * whole `vector<pair<Weight, pair<int, int>>>` in memory; here only the vertices have to fit.
+ *
+ * Approach (semi-external Kruskal):
+ * 1. **Run formation**:
+ *    - The binary edge file (records {u, v, w}: int32, int32, Weight) is read in chunks of `memoryBytes`, each chunk
+ *      is sorted by (w, u, v) in memory and written out as one sorted run.
+ *
+ * 2. **K-way merge**:
+ *    - Every run gets an equal share of the budget as its read buffer; a min-heap over the run heads yields the
+ *      edges in global weight order. With more runs than the fan-in (budget / kMinRunBuffer) allows, groups of runs
+ *      are first merged into longer runs on disk until one final pass suffices.
+ *
+ * 3. **Streaming selection**:
+ *    - The final merge is not written back: its output is fed straight into Kruskal's DisjointSet (kruskal's.cpp),
+ *      which holds O(V) ints in memory. Accepted edges go through a buffered writer to the MST file (same record
+ *      format), and the merge stops as soon as V - 1 edges are accepted.
+ *
+ * 4. **Report** (`Stats`): runs, merge passes, total bytes read / written, phase timings, edges per second and
+ *    MB/s over all I/O, MST weight (summed in long long, or long double for floating-point weights, so it cannot
+ *    overflow Weight) and edge count.
+ *
+ * Errors (unreadable input, a record with an endpoint outside [0, V), full disk) make `run` return false, like
+ * JohnsonAllPairs::writeMatrixFile. Records are checked once, during run formation. A write error stops a merge
+ * (it is never mistaken for the early stop of the final pass), and an intermediate merge must have written every
+ * record it read before its input runs are deleted. Run files live in `workDir` and are removed once merged.
+ *
+ * Time Complexity:
+ * - **O(E log E)** comparisons; I/O **O((E / B) * (1 + passes))** block transfers with
+ *   passes = ceil(log_fanIn(runs)) - 1 intermediate merge passes (0 for any realistic budget).
+ *
+ * Space Complexity:
+ * - **O(memoryBytes)** for buffers plus **O(V)** for the DisjointSet; the edges themselves stay on disk
+ *   (about 2x the input size of temporary space for the runs).
+ */
+
+template <class Weight = int, class Traits = WeightTraits<Weight>>
+class ExternalMemoryKruskal {
+public:
+    struct Edge {
+        int32_t u, v;
+        Weight w;
+        bool operator<(const Edge& o) const { return tie(w, u, v) < tie(o.w, o.u, o.v); }
+    };
+
+    struct Stats {
+        long long edges = 0, mstEdges = 0;
+        conditional_t<is_floating_point<Weight>::value, long double, long long> mstWeight = 0;
+        int runs = 0, mergePasses = 0;     // mergePasses counts intermediate passes; the final pass is not included
+        long long bytesRead = 0, bytesWritten = 0;
+        double runSeconds = 0, mergeSeconds = 0, selectSeconds = 0;
+        double edgesPerSecond = 0, ioMegabytesPerSecond = 0;
+    };
+
+    static constexpr size_t kMinRunBuffer = size_t(1) << 16;  // Smallest useful read buffer per merged run
+
+    ExternalMemoryKruskal(string workDir, size_t memoryBytes)
+        : dir(move(workDir)), budget(max(memoryBytes, 4 * kMinRunBuffer)) {}
+
+    // Reads V-vertex edges from `edgeFile`, writes the minimum spanning forest to `mstFile`.
+    bool run(int V, const string& edgeFile, const string& mstFile) {
+        stat = Stats();
+        runId = 0;
+        auto start = chrono::steady_clock::now();
+        vector<string> runs;
+        if (!formRuns(V, edgeFile, runs)) return cleanup(runs);
+        auto formed = chrono::steady_clock::now();
+        stat.runSeconds = chrono::duration<double>(formed - start).count();
+
+        size_t fanIn = max<size_t>(2, budget / kMinRunBuffer);
+        while (runs.size() > fanIn) {
+            vector<string> next;
+            long long passRead = 0, passWritten = 0;
+            for (size_t i = 0; i < runs.size(); i += fanIn) {
+                vector<string> group(runs.begin() + i, runs.begin() + min(runs.size(), i + fanIn));
+                next.push_back(runName(++runId));
+                Writer out(next.back(), budget / (group.size() + 1), stat.bytesWritten);
+                long long groupRead = 0;
+                bool merged = out.ok() && mergeRuns(group, [&](const Edge& e) {
+                    groupRead++;
+                    return out.put(e) ? Step::Next : Step::Error;
+                }) && out.close();
+                passRead += groupRead;
+                passWritten += out.records();
+                // Every record of the group must be in the new run before the group is deleted
+                if (!merged || out.records() != groupRead) {
+                    runs.insert(runs.end(), next.begin(), next.end());
+                    return cleanup(runs);
+                }
+                for (auto& r : group) remove(r.c_str());
+            }
+            runs = next;
+            stat.mergePasses++;
+            if (passRead != stat.edges || passWritten != stat.edges) return cleanup(runs);
+        }
+        auto merged = chrono::steady_clock::now();
+        stat.mergeSeconds = chrono::duration<double>(merged - formed).count();
+
+        // Final pass: merge straight into the DisjointSet
+        kruskal_impl::DisjointSet<> ds(V);
+        Writer out(mstFile, kMinRunBuffer * 16, stat.bytesWritten);
+        bool ok = out.ok() && mergeRuns(runs, [&](const Edge& e) {
+            if (ds.findUPar(e.u) == ds.findUPar(e.v)) return Step::Next;
+            ds.unionBySize(e.u, e.v);
+            stat.mstWeight += e.w;
+            stat.mstEdges++;
+            if (!out.put(e)) return Step::Error;
+            return stat.mstEdges < V - 1 ? Step::Next : Step::Stop;  // A spanning tree is complete: stop reading
+        }) && out.close() && out.records() == stat.mstEdges;
+        cleanup(runs);
+
+        auto end = chrono::steady_clock::now();
+        stat.selectSeconds = chrono::duration<double>(end - merged).count();
+        double total = chrono::duration<double>(end - start).count();
+        stat.edgesPerSecond = total > 0 ? stat.edges / total : 0;
+        stat.ioMegabytesPerSecond = total > 0 ? (stat.bytesRead + stat.bytesWritten) / total / (1 << 20) : 0;
+        return ok;
+    }
+
+    const Stats& stats() const { return stat; }
+
+    // Writes an in-memory edge list ({u, v, w} per edge) in the binary record format.
+    static bool writeEdgeFile(const string& path, const vector<vector<Weight>>& edges) {
+        long long written = 0;
+        Writer out(path, kMinRunBuffer * 16, written);
+        if (!out.ok()) return false;
+        for (auto& e : edges)
+            if (!out.put({(int32_t)e[0], (int32_t)e[1], e[2]})) return false;
+        return out.close();
+    }
+
+private:
+    // Buffered sequential record reader / writer over stdio, counting the bytes they move.
+    class Reader {
+    public:
+        Reader(const string& path, size_t bufferBytes, long long& counter)
+            : file(fopen(path.c_str(), "rb")), buffer(max<size_t>(1, bufferBytes / sizeof(Edge))), bytes(counter) {}
+        ~Reader() {
+            if (file) fclose(file);
+        }
+        bool ok() const { return file != nullptr; }
+        // Next record, or false at end of file (or on a read error, reported by failed()).
+        bool next(Edge& e) {
+            if (pos == filled) {
+                filled = fread(buffer.data(), sizeof(Edge), buffer.size(), file);
+                bytes += filled * sizeof(Edge);
+                pos = 0;
+                if (filled == 0) return false;
+            }
+            e = buffer[pos++];
+            return true;
+        }
+        // Fills `out` with up to out.size() records and returns how many were read.
+        size_t read(vector<Edge>& out) {
+            size_t got = fread(out.data(), sizeof(Edge), out.size(), file);
+            bytes += got * sizeof(Edge);
+            return got;
+        }
+        bool failed() const { return ferror(file); }
+
+    private:
+        FILE* file;
+        vector<Edge> buffer;
+        size_t pos = 0, filled = 0;
+        long long& bytes;
+    };
+
+    class Writer {
+    public:
+        Writer(const string& path, size_t bufferBytes, long long& counter)
+            : file(fopen(path.c_str(), "wb")), bytes(counter) {
+            buffer.reserve(max<size_t>(1, bufferBytes / sizeof(Edge)));
+        }
+        ~Writer() {
+            if (file) fclose(file);
+        }
+        bool ok() const { return file != nullptr; }
+        bool put(const Edge& e) {
+            buffer.push_back(e);
+            return buffer.size() < buffer.capacity() || flush();
+        }
+        bool write(const Edge* first, size_t count) {
+            size_t done = fwrite(first, sizeof(Edge), count, file);
+            bytes += done * sizeof(Edge);
+            written += done;
+            return done == count;
+        }
+        long long records() const { return written; }  // Records that reached the file
+        bool close() {
+            bool ok = flush() && fclose(file) == 0;
+            file = nullptr;
+            return ok;
+        }
+
+    private:
+        bool flush() {
+            bool ok = write(buffer.data(), buffer.size());
+            buffer.clear();
+            return ok;
+        }
+        FILE* file;
+        vector<Edge> buffer;
+        long long& bytes;
+        long long written = 0;
+    };
+
+    string runName(int id) const { return dir + "/kruskal_run_" + to_string(getpid()) + "_" + to_string(id) + ".bin"; }
+
+    bool formRuns(int V, const string& edgeFile, vector<string>& runs) {
+        Reader in(edgeFile, 0, stat.bytesRead);
+        if (!in.ok()) return false;
+        vector<Edge> chunk(max<size_t>(1, budget / sizeof(Edge)));
+        while (size_t got = in.read(chunk)) {
+            for (size_t i = 0; i < got; i++)
+                if (chunk[i].u < 0 || chunk[i].u >= V || chunk[i].v < 0 || chunk[i].v >= V) return false;
+            sort(chunk.begin(), chunk.begin() + got);
+            runs.push_back(runName(++runId));
+            stat.runs++;
+            Writer out(runs.back(), 0, stat.bytesWritten);
+            if (!out.ok() || !out.write(chunk.data(), got) || !out.close()) return false;
+            stat.edges += got;
+        }
+        return !in.failed();
+    }
+
+    // What emit(edge) asks the merge to do next: Stop ends it successfully, Error makes mergeRuns return false.
+    enum class Step { Next, Stop, Error };
+
+    // Streams the union of the sorted runs to emit(edge) in order.
+    template <class Emit>
+    bool mergeRuns(const vector<string>& runs, Emit&& emit) {
+        size_t share = max(kMinRunBuffer, budget / max<size_t>(1, runs.size() + 1));
+        vector<unique_ptr<Reader>> readers;
+        using Head = pair<Edge, int>;  // {record, run}
+        auto later = [](const Head& a, const Head& b) { return b.first < a.first; };
+        priority_queue<Head, vector<Head>, decltype(later)> heads(later);
+        for (auto& r : runs) {
+            readers.push_back(make_unique<Reader>(r, share, stat.bytesRead));
+            if (!readers.back()->ok()) return false;
+            Edge e;
+            if (readers.back()->next(e)) heads.push({e, (int)readers.size() - 1});
+        }
+        while (!heads.empty()) {
+            auto [e, r] = heads.top();
+            heads.pop();
+            Step step = emit(e);
+            if (step != Step::Next) return step == Step::Stop;
+            Edge nextEdge;
+            if (readers[r]->next(nextEdge)) heads.push({nextEdge, r});
+        }
+        for (auto& r : readers)
+            if (r->failed()) return false;
+        return true;
+    }
+
+    bool cleanup(const vector<string>& runs) {
+        for (auto& r : runs) remove(r.c_str());
+        return false;
+    }
+
+    string dir;
+    size_t budget;
+    Stats stat;
+    int runId = 0;  // Last run file number handed out
+};
+
+int main() {
+    string dir = filesystem::temp_directory_path().string();
+    string edgeFile = dir + "/kruskal_edges.bin", mstFile = dir + "/kruskal_mst.bin";
+    mt19937 rng(45);
+    auto randomEdges = [&](int V, long long m) {
+        vector<vector<int>> edges;
+        for (int v = 1; v < V; v++) edges.push_back({v, (int)(rng() % v), (int)(rng() % 1000)});  // Connected
+        while ((long long)edges.size() < m) edges.push_back({(int)(rng() % V), (int)(rng() % V), (int)(rng() % 1000)});
+        return edges;
+    };
+
+    // 1. Same MST weight as the in-memory Solution::spanningTree, with a budget that forces many runs and an
+    //    intermediate merge pass (fan-in 4 at the minimum budget)
+    int V = 50000;
+    auto edges = randomEdges(V, 400000);
+    vector<vector<int>> adj[V];
+    for (auto& e : edges) {
+        adj[e[0]].push_back({e[1], e[2]});
+        adj[e[1]].push_back({e[0], e[2]});
+    }
+    vector<vector<int>> mstGraph(V);
+    int expected = kruskal_impl::Solution().spanningTree(V, adj, mstGraph);
+    ExternalMemoryKruskal<int>::writeEdgeFile(edgeFile, edges);
+    ExternalMemoryKruskal<int> small(dir, 0);
+    bool ok = small.run(V, edgeFile, mstFile);
+    cout << "Random graph: runs " << small.stats().runs << ", merge passes " << small.stats().mergePasses
+         << ", MST weight " << small.stats().mstWeight << " (in-memory " << expected << "), "
+         << (ok && small.stats().mstWeight == expected && small.stats().mstEdges == V - 1 ? "match" : "MISMATCH")
+         << endl;
+
+    // 2. A record with an endpoint outside [0, V) fails the run instead of indexing past the DisjointSet
+    edges.push_back({V, 0, 1});
+    ExternalMemoryKruskal<int>::writeEdgeFile(edgeFile, edges);
+    ExternalMemoryKruskal<int> corrupt(dir, 0);
+    cout << "Out-of-range endpoint: " << (corrupt.run(V, edgeFile, mstFile) ? "ACCEPTED" : "rejected") << endl;
+
+    // A full disk while writing the MST (/dev/full fails every write with ENOSPC) fails the run
+    edges.pop_back();
+    ExternalMemoryKruskal<int>::writeEdgeFile(edgeFile, edges);
+    if (filesystem::exists("/dev/full")) {
+        ExternalMemoryKruskal<int> full(dir, 0);
+        cout << "Full disk: " << (full.run(V, edgeFile, "/dev/full") ? "ACCEPTED" : "rejected") << endl;
+    }
+
+    // 3. Throughput: 16M edges (192 MB on disk) through a 32 MB budget
+    V = 1 << 21;
+    edges = randomEdges(V, 16 << 20);
+    ExternalMemoryKruskal<int>::writeEdgeFile(edgeFile, edges);
+    edges.clear();
+    edges.shrink_to_fit();
+    ExternalMemoryKruskal<int> big(dir, size_t(32) << 20);
+    ok = big.run(V, edgeFile, mstFile);
+    auto& st = big.stats();
+    cout << "Edges: " << st.edges << ", runs: " << st.runs << ", MST edges: " << st.mstEdges << ", ok: " << ok << endl;
+    cout << "Read " << st.bytesRead / (1 << 20) << " MB, wrote " << st.bytesWritten / (1 << 20) << " MB; runs "
+         << st.runSeconds << " s, merge " << st.mergeSeconds << " s, select " << st.selectSeconds << " s" << endl;
+    cout << st.edgesPerSecond / 1e6 << " M edges/s, " << st.ioMegabytesPerSecond << " MB/s" << endl;
+    remove(edgeFile.c_str());
+    remove(mstFile.c_str());
+    return 0;
+}
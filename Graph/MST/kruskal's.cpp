@@ -1,4 +1,6 @@
 #include <bits/stdc++.h>
+#include "../Instrumentation/graph_counters.h"
+#include "../Weights/weight_traits.h"
 using namespace std;
 
 /*
@@ -27,11 +29,23 @@ using namespace std;
     Space Complexity:
     - **O(V + E)**: The space complexity is dominated by the adjacency list (O(V + E)) and the Disjoint Set structure (O(V)).
 
+    Weight Type:
+    - The weight type is deduced from `adj` (adj[u] = {{v, w}, ...} of `Weight`, e.g. long long for 64-bit costs);
+      the MST weight is accumulated with the saturating `Traits::add` (Weights/weight_traits.h).
+
+    Instrumentation:
+    - DisjointSet and spanningTree take a `Counters` policy (Instrumentation/graph_counters.h). The default
+      `NoCounters` compiles away; `RecordingCounters` reports find/union counts, path lengths, accepted and
+      rejected edges, and the build / sort / select phase timings.
+
 */
 
+template <class Counters = NoCounters>
 class DisjointSet {
     vector<int> rank, parent, size;
 public:
+    Counters counters;  // Operation counts (empty when instrumentation is disabled)
+
     DisjointSet(int n) {
         rank.resize(n + 1, 0);
         parent.resize(n + 1);
@@ -44,16 +58,29 @@ public:
 
     // Find operation with path compression
     int findUPar(int node) {
+        counters.count(Counter::FindCall);
+        if constexpr (Counters::enabled) {
+            int len = 0;  // Path length before compression
+            for (int cur = node; cur != parent[cur]; cur = parent[cur]) len++;
+            counters.count(Counter::FindPathStep, len);
+            counters.sample(Histogram::FindPathLength, len);
+        }
+        return findRoot(node);
+    }
+
+    int findRoot(int node) {
         if (node == parent[node])
             return node;
-        return parent[node] = findUPar(parent[node]);
+        return parent[node] = findRoot(parent[node]);
     }
 
     // Union operation by rank
     void unionByRank(int u, int v) {
+        counters.count(Counter::UnionCall);
         int ulp_u = findUPar(u);
         int ulp_v = findUPar(v);
         if (ulp_u == ulp_v) return;
+        counters.count(Counter::UnionMerge);
         if (rank[ulp_u] < rank[ulp_v]) {
             parent[ulp_u] = ulp_v;
         }
@@ -68,9 +95,11 @@ public:
 
     // Union operation by size
     void unionBySize(int u, int v) {
+        counters.count(Counter::UnionCall);
         int ulp_u = findUPar(u);
         int ulp_v = findUPar(v);
         if (ulp_u == ulp_v) return;
+        counters.count(Counter::UnionMerge);
         if (size[ulp_u] < size[ulp_v]) {
             parent[ulp_u] = ulp_v;
             size[ulp_v] += size[ulp_u];
@@ -85,14 +114,23 @@ public:
 class Solution {
 public:
     // Function to find sum of weights of edges of the Minimum Spanning Tree and construct the MST graph
-    int spanningTree(int V, vector<vector<int>> adj[], vector<vector<int>>& mstGraph) {
+    template <class Weight, class Traits = WeightTraits<Weight>>
+    Weight spanningTree(int V, vector<vector<Weight>> adj[], vector<vector<int>>& mstGraph) {
+        NoCounters counters;  // Instrumentation disabled: compiles to the plain algorithm
+        return spanningTree<Weight, Traits>(V, adj, mstGraph, counters);
+    }
+
+    // Instrumented variant; the DisjointSet's own counters are merged into `counters` at the end.
+    template <class Weight, class Traits = WeightTraits<Weight>, class Counters>
+    Weight spanningTree(int V, vector<vector<Weight>> adj[], vector<vector<int>>& mstGraph, Counters& counters) {
         // Step 1: Convert the adjacency list into an edge list
-        vector<pair<int, pair<int, int>>> edges;  // {weight, {node1, node2}}
+        counters.beginPhase("build_edges");
+        vector<pair<Weight, pair<int, int>>> edges;  // {weight, {node1, node2}}
 
         for (int i = 0; i < V; i++) {
-            for (auto it : adj[i]) {
+            for (auto& it : adj[i]) {
                 int adjNode = it[0];  // Adjacent node
-                int wt = it[1];       // Weight of the edge
+                Weight wt = it[1];    // Weight of the edge
                 int node = i;         // Current node
                 
                 // To avoid adding the same edge twice (since the graph is undirected)
@@ -102,30 +140,41 @@ public:
             }
         }
 
+        counters.endPhase();
+
         // Step 2: Initialize Disjoint Set for Kruskal's Algorithm
-        DisjointSet ds(V);
+        DisjointSet<Counters> ds(V);
 
         // Step 3: Sort the edges by weight in ascending order
+        counters.beginPhase("sort");
         sort(edges.begin(), edges.end());  
+        counters.endPhase();
 
-        int mstWt = 0;  // To keep track of the MST weight
+        Weight mstWt = 0;  // To keep track of the MST weight
 
         // Step 4: Iterate over the edges and select edges to form the MST
-        for (auto it : edges) {
-            int wt = it.first;
+        counters.beginPhase("select_edges");
+        for (auto& it : edges) {
+            Weight wt = it.first;
             int u = it.second.first;
             int v = it.second.second;
 
             // If the nodes are in different components, include this edge in the MST
             if (ds.findUPar(u) != ds.findUPar(v)) {
-                mstWt += wt;
+                mstWt = Traits::add(mstWt, wt);
                 ds.unionBySize(u, v);
 
                 // Add the edge to the MST graph (undirected graph, add both directions)
                 mstGraph[u].push_back(v);
                 mstGraph[v].push_back(u);
+                counters.count(Counter::MstEdgeAccepted);
+            }
+            else {
+                counters.count(Counter::MstEdgeRejected);
             }
         }
+        counters.endPhase();
+        if constexpr (Counters::enabled) counters.merge(ds.counters);
 
         return mstWt;  // Return the sum of weights of the MST
     }
@@ -1,4 +1,6 @@
 #include <bits/stdc++.h>
+#include "../Instrumentation/graph_counters.h"
+#include "../Weights/weight_traits.h"
 using namespace std;
 
 /*
@@ -13,6 +15,10 @@ using namespace std;
     3. Push the first node into the priority queue with a weight of 0 (starting node).
     4. Continue adding the smallest edge from the frontier until all nodes are visited.
 
+    Source:
+    - `src` (node 0 by default) is the starting node. On a disconnected graph the result is the MST of src's
+      component only, so pass a node of the component you care about.
+
     Time Complexity:
     - **O(E log V)** where V is the number of vertices and E is the number of edges.
       - For each edge, we push or pop it from the priority queue, which takes **O(log V)** time.
@@ -20,47 +26,71 @@ using namespace std;
 
     Space Complexity:
     - **O(V + E)**: The space complexity is dominated by the adjacency list (O(V + E)) and the priority queue (O(V)).
+
+    Weight Type:
+    - The weight type is deduced from `adj` (adj[u] = {{v, w}, ...} of `Weight`, e.g. long long or double); the
+      total is accumulated with the saturating `Traits::add` (Weights/weight_traits.h).
 */
 
-int spanningTree(int V, vector<vector<int>> adj[]) {
+// Instrumented variant: `Counters` is a policy from Instrumentation/graph_counters.h reporting heap
+// pushes / pops, pops of already-visited nodes, edge scans and accepted tree edges.
+template <class Weight, class Traits = WeightTraits<Weight>, class Counters>
+Weight spanningTree(int V, vector<vector<Weight>> adj[], int src, Counters& counters) {
+    counters.beginPhase("prim");
+
     // Initialize the priority queue with a pair of (weight, node).
-    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> pq;
+    priority_queue<pair<Weight, int>, vector<pair<Weight, int>>, greater<pair<Weight, int>>> pq;
     
     // Vector to track visited nodes, initially all nodes are unvisited.
     vector<int> vis(V, 0);
     
-    // Start with node 0 and its weight 0.
-    pq.push({0, 0});
-    int ans = 0;  // Variable to store the total weight of the MST.
+    // Start with the source node and its weight 0.
+    pq.push({0, src});
+    counters.count(Counter::HeapPush);
+    Weight ans = 0;  // Variable to store the total weight of the MST.
     
     while (!pq.empty()) {
         // Extract the node with the minimum weight from the priority queue.
         auto it = pq.top();
         pq.pop();
+        counters.count(Counter::HeapPop);
         
         int node = it.second;  // The node with the minimum weight.
-        int wt = it.first;  // The weight of the edge to this node.
+        Weight wt = it.first;  // The weight of the edge to this node.
         
         // If the node is already visited, we skip it.
-        if (vis[node] == 1) continue;
+        if (vis[node] == 1) {
+            counters.count(Counter::StalePop);
+            continue;
+        }
         
         // Mark the node as visited.
         vis[node] = 1;
         
         // Add the weight of the current edge to the MST.
-        ans += wt;
+        ans = Traits::add(ans, wt);
+        if (node != src) counters.count(Counter::MstEdgeAccepted);  // The source is the root, not an edge
         
         // Explore all adjacent nodes (neighbors of the current node).
-        for (auto itr : adj[node]) {
+        for (auto& itr : adj[node]) {
             int adj_node = itr[0];  // Adjacent node.
-            int adj_wt = itr[1];  // Weight of the edge to the adjacent node.
+            Weight adj_wt = itr[1];  // Weight of the edge to the adjacent node.
+            counters.count(Counter::EdgeScan);
             
             // If the adjacent node is not visited, push it to the priority queue.
             if (vis[adj_node] != 1) {
                 pq.push({adj_wt, adj_node});
+                counters.count(Counter::HeapPush);
             }
         }
     }
     
+    counters.endPhase();
     return ans;  // Return the total weight of the MST.
 }
+
+template <class Weight, class Traits = WeightTraits<Weight>>
+Weight spanningTree(int V, vector<vector<Weight>> adj[], int src = 0) {
+    NoCounters counters;  // Instrumentation disabled: compiles to the plain algorithm
+    return spanningTree<Weight, Traits>(V, adj, src, counters);
+}
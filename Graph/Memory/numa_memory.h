@@ -0,0 +1,258 @@
+#ifndef GRAPH_MEMORY_NUMA_MEMORY_H
+#define GRAPH_MEMORY_NUMA_MEMORY_H
+
+#include <bits/stdc++.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+using namespace std;
+
+/*
+    Huge-page and NUMA placement for the large arrays of a graph (adjacency, dist, vis, parent ...).
+
+    A std::vector is allocated by malloc on the calling thread and zero-filled there, so on a multi-socket machine
+    every page lands on the constructing thread's node (first touch), and 4 KB pages make random neighbour reads
+    TLB misses. LargeArray<T> takes the placement decisions explicitly:
+
+    1. **Pages** (`PagePolicy`):
+       - `Normal`      : plain anonymous mmap.
+       - `Transparent` : madvise(MADV_HUGEPAGE), the kernel backs the range with 2 MB pages when it can
+                         (works with transparent_hugepage = madvise or always).
+       - `Explicit`    : MAP_HUGETLB from the reserved hugetlbfs pool (vm.nr_hugepages); falls back to
+                         Transparent when the pool is empty, `usedExplicitHugePages()` tells which one happened.
+
+    2. **NUMA** (`NumaPolicy`, applied with the raw mbind syscall so no libnuma is needed):
+       - `FirstTouch`  : no binding; pages go where `firstTouch` (below) writes them first.
+       - `Interleave`  : pages round-robin over all nodes. Best for data every thread reads randomly (the
+                         adjacency of a BFS / Dijkstra run from arbitrary sources).
+       - `Partitioned` : the array is split into `partitions` contiguous ranges (the same split as the parallel
+                         loops: range t belongs to worker t) and range t is bound to node `numaNodeOf(t)`. Range
+                         boundaries are rounded to the mapping's page size (2 MB for MAP_HUGETLB, which mbind
+                         requires). Best for arrays each worker mostly writes in its own range.
+       Node ids are the online ids from sysfs, which need not be 0 .. count - 1 ("0,2-3" after offlining node 1);
+       `numaNodeOf(t)` maps worker t to ids[t % count]. On a single-node machine the NUMA policies are no-ops.
+       `usedNumaBinding()` is true when the policy was applied and every mbind call succeeded.
+
+    3. **First-touch initialization**: `firstTouch(threads, value)` fills the array with `threads` workers, worker t
+       writing range t after pinning itself to node `numaNodeOf(t)` (`pinToNode`), so even FirstTouch arrays are
+       spread the same way the parallel traversal will read them. Nothing is written before that: LargeArray never
+       zero-fills on the constructing thread.
+
+    4. **Views**: `CsrRows<T>` turns an offset array and a data array into `g[u]` ranges, the adjacency interface the
+       templated routines iterate (the unit-weight BFS and dijkstra workspace overloads, kosaraju, topological sorts).
+
+    Per-thread scratch (QueryWorkspace) needs none of this: each worker allocates and first touches its own
+    workspace, so it is node-local by construction.
+
+    Usage:
+        LargeArray<int> target(m, {PagePolicy::Transparent, NumaPolicy::Interleave});
+        target.firstTouch(threads, 0);             // or fill it from a parallel loop
+        CsrRows<int> adj(offset.data(), target.data(), n);
+        Solution().shortestPath(n, adj, s, -1, ws);
+
+    Benchmark/bench_numa.cpp compares the policies on the workspace BFS and Dijkstra engines.
+*/
+
+enum class PagePolicy { Normal, Transparent, Explicit };
+enum class NumaPolicy { FirstTouch, Interleave, Partitioned };
+
+struct MemoryPolicy {
+    PagePolicy pages = PagePolicy::Transparent;
+    NumaPolicy numa = NumaPolicy::FirstTouch;
+    int partitions = 1;  // Ranges for NumaPolicy::Partitioned (usually the worker count)
+};
+
+// Ids of the online NUMA nodes, parsed from sysfs ("0-1", "0,2-3"); {0} when unavailable.
+inline const vector<int>& numaNodeIds() {
+    static const vector<int> ids = [] {
+        vector<int> online;
+        ifstream in("/sys/devices/system/node/online");
+        string list;
+        if (in >> list) {
+            stringstream ss(list);
+            for (string part; getline(ss, part, ',');) {
+                size_t dash = part.find('-');
+                int lo = stoi(part.substr(0, dash)), hi = dash == string::npos ? lo : stoi(part.substr(dash + 1));
+                for (int id = lo; id <= hi; id++) online.push_back(id);
+            }
+        }
+        if (online.empty()) online.push_back(0);
+        return online;
+    }();
+    return ids;
+}
+
+inline int numaNodeCount() { return numaNodeIds().size(); }
+
+// Node of worker / range t: the online nodes round-robin.
+inline int numaNodeOf(int t) { return numaNodeIds()[t % numaNodeCount()]; }
+
+// Pins the calling thread to the CPUs of `node` (sysfs cpulist). Returns false if the node or the call is unavailable.
+inline bool pinToNode(int node) {
+    ifstream in("/sys/devices/system/node/node" + to_string(node) + "/cpulist");
+    string list;
+    if (!(in >> list)) return false;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    stringstream ss(list);
+    for (string part; getline(ss, part, ',');) {
+        size_t dash = part.find('-');
+        int lo = stoi(part.substr(0, dash)), hi = dash == string::npos ? lo : stoi(part.substr(dash + 1));
+        for (int c = lo; c <= hi; c++) CPU_SET(c, &set);
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+// AnonHugePages of this process in KB (/proc/self/smaps_rollup), -1 when unavailable.
+inline long anonHugePagesKb() {
+    ifstream in("/proc/self/smaps_rollup");
+    for (string key; in >> key;) {
+        if (key == "AnonHugePages:") {
+            long kb;
+            in >> kb;
+            return kb;
+        }
+    }
+    return -1;
+}
+
+template <class T>
+class LargeArray {
+    static_assert(is_trivially_copyable<T>::value, "LargeArray holds raw memory; T must be trivially copyable");
+
+public:
+    static constexpr size_t kHugePage = size_t(2) << 20;
+
+    LargeArray() = default;
+    LargeArray(size_t count, MemoryPolicy policy = {}) : n(count), pol(policy) {
+        if (n == 0) return;
+        bytes = (n * sizeof(T) + kHugePage - 1) / kHugePage * kHugePage;  // Whole huge pages
+        void* p = MAP_FAILED;
+        if (pol.pages == PagePolicy::Explicit) {
+            p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            explicitPages = p != MAP_FAILED;
+        }
+        if (p == MAP_FAILED) p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED) throw bad_alloc();
+        ptr = static_cast<T*>(p);
+        if (!explicitPages && pol.pages != PagePolicy::Normal) madvise(ptr, bytes, MADV_HUGEPAGE);
+        applyNumaPolicy();
+    }
+
+    ~LargeArray() { release(); }
+
+    LargeArray(LargeArray&& o) noexcept { *this = move(o); }
+    LargeArray& operator=(LargeArray&& o) noexcept {
+        if (this != &o) {
+            release();
+            ptr = exchange(o.ptr, nullptr);
+            n = exchange(o.n, 0);
+            bytes = exchange(o.bytes, 0);
+            pol = o.pol;
+            explicitPages = o.explicitPages;
+            numaBound = o.numaBound;
+        }
+        return *this;
+    }
+    LargeArray(const LargeArray&) = delete;
+    LargeArray& operator=(const LargeArray&) = delete;
+
+    // Writes `value` everywhere with `threads` workers; worker t owns range t and runs on node numaNodeOf(t).
+    void firstTouch(int threads, const T& value) {
+        parallelRanges(threads, [&](size_t lo, size_t hi) { fill(ptr + lo, ptr + hi, value); });
+    }
+
+    // fn(lo, hi) on `threads` contiguous ranges, each on a worker pinned to node numaNodeOf(t): the split every
+    // first-touch fill and Partitioned binding use.
+    template <class Fn>
+    void parallelRanges(int threads, Fn&& fn) {
+        threads = max(1, threads);
+        size_t chunk = (n + threads - 1) / threads;
+        vector<thread> pool;
+        for (int t = 0; t < threads; t++) {
+            size_t lo = min(n, t * chunk), hi = min(n, lo + chunk);
+            pool.emplace_back([&, t, lo, hi] {
+                if (numaNodeCount() > 1) pinToNode(numaNodeOf(t));
+                fn(lo, hi);
+            });
+        }
+        for (auto& th : pool) th.join();
+    }
+
+    T* data() { return ptr; }
+    const T* data() const { return ptr; }
+    size_t size() const { return n; }
+    T& operator[](size_t i) { return ptr[i]; }
+    const T& operator[](size_t i) const { return ptr[i]; }
+    T* begin() { return ptr; }
+    T* end() { return ptr + n; }
+    size_t mappedBytes() const { return bytes; }
+    bool usedExplicitHugePages() const { return explicitPages; }
+    bool usedNumaBinding() const { return numaBound; }
+
+private:
+    void applyNumaPolicy() {
+        if (numaNodeCount() < 2 || pol.numa == NumaPolicy::FirstTouch) return;
+        const int kMpolBind = 2, kMpolInterleave = 3;  // <numaif.h> values
+        const vector<int>& ids = numaNodeIds();
+        numaBound = true;
+        auto bind = [&](size_t lo, size_t hi, int mode, const vector<int>& nodes) {
+            vector<unsigned long> mask(ids.back() / 64 + 1, 0);
+            for (int id : nodes) mask[id / 64] |= 1UL << (id % 64);
+            // maxnode + 1: the kernel reads maxnode - 1 bits
+            long rc = syscall(SYS_mbind, reinterpret_cast<char*>(ptr) + lo, hi - lo, mode, mask.data(),
+                              mask.size() * 64 + 1, 0);
+            numaBound = numaBound && rc == 0;
+        };
+        if (pol.numa == NumaPolicy::Interleave) {
+            bind(0, bytes, kMpolInterleave, ids);
+            return;
+        }
+        // Partitioned: ranges matching parallelRanges(partitions), boundaries rounded down to the mapping's page
+        // size so consecutive ranges neither overlap nor leave gaps
+        int parts = max(1, pol.partitions);
+        size_t chunk = (n + parts - 1) / parts * sizeof(T);
+        size_t page = explicitPages ? kHugePage : sysconf(_SC_PAGESIZE);
+        auto boundary = [&](int t) { return t == parts ? bytes : min(bytes, t * chunk / page * page); };
+        for (int t = 0; t < parts; t++) {
+            size_t lo = boundary(t), hi = boundary(t + 1);
+            if (lo < hi) bind(lo, hi, kMpolBind, {numaNodeOf(t)});
+        }
+    }
+
+    void release() {
+        if (ptr) munmap(ptr, bytes);
+        ptr = nullptr;
+    }
+
+    T* ptr = nullptr;
+    size_t n = 0, bytes = 0;
+    MemoryPolicy pol;
+    bool explicitPages = false;
+    bool numaBound = false;  // The NUMA policy was applied with mbind, and every call succeeded
+};
+
+// Row view over CSR arrays: rows[u] iterates data[offset[u] .. offset[u + 1]).
+template <class T, class Offset = long long>
+class CsrRows {
+public:
+    struct Row {
+        const T *first, *last;
+        const T* begin() const { return first; }
+        const T* end() const { return last; }
+        size_t size() const { return last - first; }
+    };
+
+    CsrRows(const Offset* offset, const T* data, int nodes) : off(offset), items(data), n(nodes) {}
+    Row operator[](int u) const { return {items + off[u], items + off[u + 1]}; }
+    size_t size() const { return n; }
+
+private:
+    const Offset* off;
+    const T* items;
+    int n;
+};
+
+#endif
@@ -0,0 +1,291 @@
+#include <bits/stdc++.h>
+#include <pthread.h>
+using namespace std;
+
+#include "../Instrumentation/graph_counters.h"
+namespace scc_impl {
+#include "../strongly_connected_componenets.cpp"
+}
+
+/*
+ * Problem: Answer "can u reach v?" for millions of (u, v) pairs on one directed graph, where kosaraju only returns
+ * a component count and every query would otherwise be a fresh DFS.
+ *
+ * Approach:
+ * 1. **Condensation**:
+ *    - `scc_impl::solution().condense(n, adj)` labels the SCCs in topological order, so every edge of the
+ *      condensation DAG goes from a smaller to a larger component id, and returns the deduplicated
+ *      inter-component edges in CSR form (`dagOffset` / `dagTarget`).
+ *
+ * 2. **Chunked bitset transitive closure**:
+ *    - The closure row of component c is the set of components it reaches, stored sparsely: only the 512-bit
+ *      chunks (8 words) that contain a set bit are kept, with their chunk ids in increasing order.
+ *    - Rows are built in reverse topological order (c = C-1 .. 0): row(c) = {c} OR row(d) for every successor d.
+ *      Successor chunks are ORed into a dense scratch accumulator with fixed 8-word loops the compiler
+ *      vectorizes, then the touched chunks are sorted and appended to one shared pool.
+ *    - Because ids are topological, row(c) only has bits >= c, which keeps the rows of downstream components small.
+ *
+ * 3. **Memory budget**:
+ *    - If the pool would grow past `maxBytes`, the remaining (upstream) rows are not materialized. Queries from
+ *      such a component run a DFS over the condensation that stops at the first component with a row (a bit test
+ *      answers everything below it). Every query stays exact; only its cost degrades.
+ *
+ * 4. **Negative cuts** (O(1) per component, always built):
+ *    - `level[c]`: longest path from a source component. c can only reach d if level[c] < level[d].
+ *    - `lastReach[c]`: largest component id reachable from c. c can only reach d if d <= lastReach[c].
+ *
+ * 5. **Query** `reaches(u, v)`:
+ *    - Same component -> true; component[u] > component[v] or a failed negative cut -> false.
+ *    - Materialized row -> binary search of chunk id v / 512 in the row, then one bit test.
+ *    - Otherwise the fallback DFS, which applies the same cuts to every component it would expand.
+ *
+ * Time Complexity:
+ * - Build: **O(V + E)** for SCC + condensation, plus **O(sum over DAG edges of |row(target)| * 8 words)** for the
+ *   closure.
+ * - Query: **O(log chunks in row)** when the row is materialized.
+ *
+ * Space Complexity:
+ * - **O(V + E)** for the condensation plus the chunk pool (at most `maxBytes`).
+ *
+ * kosaraju is recursive: on large graphs build the index on a thread with a large stack (see main).
+ */
+
+class ReachabilityIndex {
+public:
+    static constexpr int kChunkWords = 8;  // 512 bits per chunk
+    static constexpr int kChunkBits = kChunkWords * 64;
+
+    struct Stats {
+        int nodes = 0, components = 0;
+        long long dagEdges = 0;
+        int materializedRows = 0;  // Components with a closure row (the rest fall back to a pruned DFS)
+        long long chunks = 0;
+        size_t memoryBytes = 0;    // Condensation + closure pool + per-row offsets
+        double condenseSeconds = 0, cutsSeconds = 0, closureSeconds = 0;
+    };
+
+    // adj[u] = {v, ...}: the kosaraju input format.
+    ReachabilityIndex(int n, vector<vector<int>>& adj, size_t maxBytes = size_t(1) << 30) {
+        auto now = [] { return chrono::steady_clock::now(); };
+        auto seconds = [](auto a, auto b) { return chrono::duration<double>(b - a).count(); };
+        stat.nodes = n;
+
+        auto t0 = now();
+        scc_impl::Condensation dag = scc_impl::solution().condense(n, adj);
+        C = dag.components;
+        component = move(dag.component);
+        dagOffset = move(dag.offset);
+        dagTarget = move(dag.target);
+        auto t1 = now();
+        buildCuts();
+        auto t2 = now();
+        buildClosure(maxBytes);
+        auto t3 = now();
+
+        stat.components = C;
+        stat.dagEdges = dagTarget.size();
+        stat.chunks = chunkId.size();
+        stat.memoryBytes = component.size() * sizeof(int) + dagOffset.size() * sizeof(int) +
+                           level.size() * sizeof(int) + lastReach.size() * sizeof(int) +
+                           dagTarget.size() * sizeof(int) + (rowBegin.size() + rowEnd.size()) * sizeof(long long) +
+                           chunkId.size() * sizeof(uint32_t) + words.size() * sizeof(uint64_t);
+        stat.condenseSeconds = seconds(t0, t1);
+        stat.cutsSeconds = seconds(t1, t2);
+        stat.closureSeconds = seconds(t2, t3);
+    }
+
+    bool reaches(int u, int v) const {
+        int cu = component[u], cv = component[v];
+        if (cu == cv) return true;
+        if (cu > cv || !mayReach(cu, cv)) return false;  // Condensation edges only go to larger ids
+        if (rowBegin[cu] != -1) return rowHas(cu, cv);
+        return searchFrom(cu, cv);
+    }
+
+    int componentOf(int v) const { return component[v]; }
+    int componentCount() const { return C; }
+    const Stats& stats() const { return stat; }
+
+    // Successor components of c in the condensation DAG.
+    pair<const int*, const int*> successors(int c) const {
+        return {dagTarget.data() + dagOffset[c], dagTarget.data() + dagOffset[c + 1]};
+    }
+
+private:
+    void buildCuts() {
+        level.assign(C, 0);
+        for (int c = 0; c < C; c++) {  // Topological order
+            for (int i = dagOffset[c]; i < dagOffset[c + 1]; i++) level[dagTarget[i]] = max(level[dagTarget[i]], level[c] + 1);
+        }
+        lastReach.resize(C);
+        for (int c = C - 1; c >= 0; c--) {  // Reverse topological order
+            lastReach[c] = c;
+            for (int i = dagOffset[c]; i < dagOffset[c + 1]; i++) lastReach[c] = max(lastReach[c], lastReach[dagTarget[i]]);
+        }
+    }
+
+    bool mayReach(int c, int d) const { return level[c] < level[d] && d <= lastReach[c]; }
+
+    void buildClosure(size_t maxBytes) {
+        int numChunks = (C + kChunkBits - 1) / kChunkBits;
+        rowBegin.assign(C, -1);
+        rowEnd.assign(C, -1);
+        vector<uint64_t> acc(size_t(numChunks) * kChunkWords, 0);  // Dense scratch row
+        vector<char> touched(numChunks, 0);
+        vector<uint32_t> touchedList;
+        const size_t bytesPerChunk = sizeof(uint32_t) + kChunkWords * sizeof(uint64_t);
+
+        for (int c = C - 1; c >= 0; c--) {
+            auto touch = [&](uint32_t k) {
+                if (!touched[k]) {
+                    touched[k] = 1;
+                    touchedList.push_back(k);
+                }
+            };
+            touch(c / kChunkBits);
+            acc[size_t(c / kChunkBits) * kChunkWords + (c % kChunkBits) / 64] |= uint64_t(1) << (c % 64);
+
+            for (int i = dagOffset[c]; i < dagOffset[c + 1]; i++) {
+                int d = dagTarget[i];
+                for (long long k = rowBegin[d]; k < rowEnd[d]; k++) {
+                    uint32_t id = chunkId[k];
+                    touch(id);
+                    uint64_t* dst = &acc[size_t(id) * kChunkWords];
+                    const uint64_t* src = &words[size_t(k) * kChunkWords];
+                    for (int w = 0; w < kChunkWords; w++) dst[w] |= src[w];  // Vectorized OR
+                }
+            }
+
+            // Budget check before appending; successors are all materialized (reverse topological order)
+            if ((chunkId.size() + touchedList.size()) * bytesPerChunk > maxBytes) {
+                for (uint32_t k : touchedList) {
+                    fill_n(&acc[size_t(k) * kChunkWords], kChunkWords, 0);
+                    touched[k] = 0;
+                }
+                touchedList.clear();
+                break;  // This and every upstream component fall back to searchFrom
+            }
+
+            sort(touchedList.begin(), touchedList.end());
+            rowBegin[c] = chunkId.size();
+            for (uint32_t k : touchedList) {
+                chunkId.push_back(k);
+                uint64_t* src = &acc[size_t(k) * kChunkWords];
+                words.insert(words.end(), src, src + kChunkWords);
+                fill_n(src, kChunkWords, 0);
+                touched[k] = 0;
+            }
+            rowEnd[c] = chunkId.size();
+            touchedList.clear();
+            stat.materializedRows++;
+        }
+    }
+
+    bool rowHas(int c, int target) const {
+        uint32_t k = target / kChunkBits;
+        auto first = chunkId.begin() + rowBegin[c], last = chunkId.begin() + rowEnd[c];
+        auto it = lower_bound(first, last, k);
+        if (it == last || *it != k) return false;
+        const uint64_t* chunk = &words[size_t(it - chunkId.begin()) * kChunkWords];
+        return chunk[(target % kChunkBits) / 64] >> (target % 64) & 1;
+    }
+
+    // DFS over the unmaterialized upper part of the condensation; materialized components answer by bit test.
+    bool searchFrom(int source, int target) const {
+        vector<int> stack = {source};
+        unordered_set<int> seen = {source};
+        while (!stack.empty()) {
+            int c = stack.back();
+            stack.pop_back();
+            for (int i = dagOffset[c]; i < dagOffset[c + 1]; i++) {
+                int d = dagTarget[i];
+                if (d == target) return true;
+                if (!mayReach(d, target) || !seen.insert(d).second) continue;
+                if (rowBegin[d] != -1) {
+                    if (rowHas(d, target)) return true;
+                } else {
+                    stack.push_back(d);
+                }
+            }
+        }
+        return false;
+    }
+
+    int C = 0;
+    vector<int> component;
+    vector<int> dagOffset, dagTarget;   // Condensation DAG in CSR form
+    vector<int> level, lastReach;       // Negative cuts
+    vector<long long> rowBegin, rowEnd;  // Closure row of c: chunks [rowBegin[c], rowEnd[c]), -1 if not built
+    vector<uint32_t> chunkId;            // Chunk ids of all rows, increasing within a row
+    vector<uint64_t> words;              // kChunkWords words per chunk
+    Stats stat;
+};
+
+// Runs fn on a thread with a 1 GB stack (kosaraju recursion on large graphs).
+static void runWithLargeStack(const function<void()>& fn) {
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, size_t(1) << 30);
+    pthread_t handle;
+    auto entry = [](void* p) -> void* {
+        (*static_cast<const function<void()>*>(p))();
+        return nullptr;
+    };
+    pthread_create(&handle, &attr, entry, const_cast<function<void()>*>(&fn));
+    pthread_join(handle, nullptr);
+    pthread_attr_destroy(&attr);
+}
+
+int main() {
+    mt19937 rng(41);
+    auto randomGraph = [&](int n, int m, double backEdges) {
+        // Mostly forward edges (a DAG-like dependency graph) with a fraction of back edges forming SCCs
+        vector<vector<int>> adj(n);
+        for (int i = 0; i < m; i++) {
+            int u = rng() % n, v = rng() % n;
+            bool back = (rng() % 1000) < backEdges * 1000;
+            if ((u < v) == back) swap(u, v);
+            if (u != v) adj[u].push_back(v);
+        }
+        return adj;
+    };
+
+    runWithLargeStack([&] {
+        // 1. Correctness against BFS, with a full closure and with a tiny budget (forces the DFS fallback)
+        int n = 3000, mismatches = 0;
+        auto adj = randomGraph(n, 6000, 0.02);
+        ReachabilityIndex full(n, adj), partial(n, adj, 4096);
+        for (int s = 0; s < n; s += 37) {
+            vector<char> seen(n, 0);
+            vector<int> q = {s};
+            seen[s] = 1;
+            for (size_t h = 0; h < q.size(); h++)
+                for (int v : adj[q[h]])
+                    if (!seen[v]) seen[v] = 1, q.push_back(v);
+            for (int t = 0; t < n; t++) {
+                if (full.reaches(s, t) != (bool)seen[t]) mismatches++;
+                if (partial.reaches(s, t) != (bool)seen[t]) mismatches++;
+            }
+        }
+        cout << "Components: " << full.componentCount() << ", rows (full / budget): "
+             << full.stats().materializedRows << " / " << partial.stats().materializedRows
+             << ", mismatches: " << mismatches << endl;
+
+        // 2. Build report and query rate on a million-node graph
+        n = 1 << 20;
+        auto big = randomGraph(n, 2 * n, 0.001);
+        ReachabilityIndex index(n, big, size_t(512) << 20);
+        auto& st = index.stats();
+        cout << "Nodes: " << st.nodes << ", components: " << st.components << ", DAG edges: " << st.dagEdges
+             << ", rows: " << st.materializedRows << ", chunks: " << st.chunks
+             << ", memory: " << st.memoryBytes / (1 << 20) << " MB" << endl;
+        cout << "Build: condense " << st.condenseSeconds << " s, cuts " << st.cutsSeconds << " s, closure "
+             << st.closureSeconds << " s" << endl;
+        int queries = 1000000, yes = 0;
+        auto t0 = chrono::steady_clock::now();
+        for (int i = 0; i < queries; i++) yes += index.reaches(rng() % n, rng() % n);
+        double secs = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+        cout << "Queries: " << queries / secs / 1e6 << " M/s, reachable: " << yes << endl;
+    });
+    return 0;
+}
@@ -0,0 +1,278 @@
+#ifndef GRAPH_SERVER_GRAPH_QUERY_SERVER_H
+#define GRAPH_SERVER_GRAPH_QUERY_SERVER_H
+
+#include <bits/stdc++.h>
+#include "../Instrumentation/graph_counters.h"
+#include "../Weights/weight_traits.h"
+#include "../Workspace/query_workspace.h"
+using namespace std;
+
+/*
+    Concurrent query executor over one immutable, shared graph.
+
+    The Solution classes allocate their O(V) arrays on every call and say nothing about threads. This executor
+    serves many small queries from many threads against one loaded graph:
+
+    1. **SharedGraph** is built once and never modified afterwards, so any number of workers may read it without
+       locks. It holds the dijkstra adjacency ({{v, w}, ...}), the undirected neighbour lists for BFS and a
+       component label per node (computed with Disjoint_Set_Union's DisjointSet at load time, because findUPar
+       compresses paths and therefore is not safe to call concurrently).
+
+    2. **Queries**:
+       - `Connected(s, t)` : 1 if s and t are in the same (weakly) connected component, else 0. O(1).
+       - `Distance(s, t)`  : weighted shortest distance, the workspace dijkstra with early exit at t.
+       - `Hops(s, t)`      : unweighted hop count, the workspace unit-weight BFS with early exit at t.
+       Every query answers -1 when t is unreachable from s.
+
+    3. **Workers** each own a QueryWorkspace (Workspace/query_workspace.h), so after warm-up a query allocates
+       nothing and only touches the part of the graph it explores.
+
+    4. **Batching**: `submit` appends to one queue; a worker takes up to `maxBatch` queries per lock acquisition,
+       so under load the queue lock and condition variable are paid once per batch instead of once per query.
+       `submitBatch` enqueues a whole client batch under a single lock.
+
+    5. **Stats**: every query's latency (submit -> result available) is recorded by its worker; `stats()` reports
+       the completed count, throughput since construction / `resetStats()` and latency percentiles. Each worker
+       keeps a fixed histogram of ~2.5k log-spaced buckets (1% apart, 0.01 us .. 1000 s) instead of a sample
+       log, so a long-running server uses ~20 KB per worker for stats; percentiles are bucket upper bounds
+       (within 1%), the count and max are exact.
+
+    Usage:
+        auto graph = make_shared<const SharedGraph>(n, edges, true);  // edges = {{u, v, w}, ...}
+        GraphQueryServer server(graph, thread::hardware_concurrency());
+        future<long long> d = server.submit({QueryKind::Distance, s, t});
+        cout << d.get() << " " << server.stats().p99Micros << endl;
+
+    The workspace routines are iterative, so the workers run on plain std::threads (no large stacks needed).
+    Benchmark/bench_query_server.cpp is the load generator.
+*/
+
+namespace query_server_impl {
+namespace dijkstra {
+#include "../Shortet_Path/dijkstras_positive_weights.cpp"
+}
+namespace unit_bfs {
+#include "../Shortet_Path/shortest_path_in_undirected_graph_with_unit_weight.cpp"
+}
+#define main dsu_demo_main
+namespace dsu {
+#include "../Disjoint_Set_Union/disjoint_set_union.cpp"
+}
+#undef main
+}  // namespace query_server_impl
+
+enum class QueryKind { Connected, Distance, Hops };
+
+struct Query {
+    QueryKind kind;
+    int source, target;
+};
+
+struct SharedGraph {
+    int n;
+    vector<vector<vector<int>>> weighted;  // weighted[u] = {{v, w}, ...}
+    vector<vector<int>> neighbours;        // Undirected neighbour lists (both directions of every edge)
+    vector<int> component;                 // Component label of every node
+
+    // edges = {{u, v, w}, ...}; with directed = false every edge is usable both ways by Distance.
+    SharedGraph(int nodes, const vector<vector<int>>& edges, bool directed)
+        : n(nodes), weighted(nodes), neighbours(nodes), component(nodes) {
+        query_server_impl::dsu::DisjointSet<> ds(n);
+        for (auto& e : edges) {
+            weighted[e[0]].push_back({e[1], e[2]});
+            if (!directed) weighted[e[1]].push_back({e[0], e[2]});
+            neighbours[e[0]].push_back(e[1]);
+            neighbours[e[1]].push_back(e[0]);
+            ds.unionBySize(e[0], e[1]);
+        }
+        for (int v = 0; v < n; v++) component[v] = ds.findUPar(v);
+    }
+
+    // Answers one query with the caller's workspace. Safe to call from many threads at once (one workspace each).
+    long long answer(const Query& q, QueryWorkspace<int>& ws) const {
+        // The repo routines take non-const adjacency lists but never modify them.
+        auto& adj = const_cast<SharedGraph&>(*this);
+        switch (q.kind) {
+        case QueryKind::Connected:
+            return component[q.source] == component[q.target];
+        case QueryKind::Distance: {
+            if (component[q.source] != component[q.target]) return -1;
+            int d = query_server_impl::dijkstra::Solution().dijkstra(n, adj.weighted.data(), q.source, q.target, ws);
+            return d == INT_MAX ? -1 : d;
+        }
+        case QueryKind::Hops:
+            if (component[q.source] != component[q.target]) return -1;
+            return query_server_impl::unit_bfs::Solution().shortestPath(n, adj.neighbours, q.source, q.target, ws);
+        }
+        return -1;
+    }
+};
+
+struct ServerStats {
+    long long completed = 0;
+    double seconds = 0;  // Since construction or the last resetStats()
+    double qps = 0;
+    double p50Micros = 0, p95Micros = 0, p99Micros = 0, maxMicros = 0;
+};
+
+class GraphQueryServer {
+public:
+    GraphQueryServer(shared_ptr<const SharedGraph> g, int threads, int maxBatch = 64)
+        : graph(move(g)), batchLimit(max(1, maxBatch)), latencies(max(1, threads)) {
+        statsStart = chrono::steady_clock::now();
+        for (int t = 0; t < max(1, threads); t++) workers.emplace_back([this, t] { workerLoop(t); });
+    }
+
+    // Finishes every queued query, then stops the workers.
+    ~GraphQueryServer() {
+        {
+            lock_guard<mutex> lock(queueMutex);
+            stopping = true;
+        }
+        queueReady.notify_all();
+        for (auto& w : workers) w.join();
+    }
+
+    GraphQueryServer(const GraphQueryServer&) = delete;
+    GraphQueryServer& operator=(const GraphQueryServer&) = delete;
+
+    future<long long> submit(const Query& q) {
+        Pending p{q, {}, chrono::steady_clock::now()};
+        future<long long> result = p.result.get_future();
+        {
+            lock_guard<mutex> lock(queueMutex);
+            queue.push_back(move(p));
+        }
+        queueReady.notify_one();
+        return result;
+    }
+
+    // Enqueues all queries under one lock; results are in query order.
+    vector<future<long long>> submitBatch(const vector<Query>& qs) {
+        vector<future<long long>> results;
+        results.reserve(qs.size());
+        auto now = chrono::steady_clock::now();
+        {
+            lock_guard<mutex> lock(queueMutex);
+            for (auto& q : qs) {
+                queue.push_back({q, {}, now});
+                results.push_back(queue.back().result.get_future());
+            }
+        }
+        queueReady.notify_all();
+        return results;
+    }
+
+    // Convenience: submits a batch and waits for all of it.
+    vector<long long> run(const vector<Query>& qs) {
+        vector<long long> out;
+        for (auto& f : submitBatch(qs)) out.push_back(f.get());
+        return out;
+    }
+
+    ServerStats stats() {
+        ServerStats s;
+        vector<long long> all(kLatencyBuckets, 0);
+        for (auto& l : latencies) {
+            lock_guard<mutex> lock(l.m);
+            for (int b = 0; b < kLatencyBuckets; b++) all[b] += l.buckets[b];
+            s.completed += l.count;
+            s.maxMicros = max(s.maxMicros, l.maxMicros);
+        }
+        s.seconds = chrono::duration<double>(chrono::steady_clock::now() - statsStart).count();
+        s.qps = s.seconds > 0 ? s.completed / s.seconds : 0;
+        if (s.completed > 0) {
+            auto pct = [&](double p) {
+                long long k = min(s.completed - 1, (long long)(p * s.completed)), seen = 0;
+                int b = 0;
+                while ((seen += all[b]) <= k) b++;
+                return min(s.maxMicros, kMinMicros * pow(kGrowth, b));
+            };
+            s.p50Micros = pct(0.50);
+            s.p95Micros = pct(0.95);
+            s.p99Micros = pct(0.99);
+        }
+        return s;
+    }
+
+    void resetStats() {
+        for (auto& l : latencies) {
+            lock_guard<mutex> lock(l.m);
+            fill(l.buckets.begin(), l.buckets.end(), 0);
+            l.count = 0;
+            l.maxMicros = 0;
+        }
+        statsStart = chrono::steady_clock::now();
+    }
+
+    int threads() const { return workers.size(); }
+
+private:
+    struct Pending {
+        Query query;
+        promise<long long> result;
+        chrono::steady_clock::time_point submitted;
+    };
+
+    // Latency histogram: bucket 0 holds <= kMinMicros, bucket b holds (kMinMicros * kGrowth^(b-1),
+    // kMinMicros * kGrowth^b], the last bucket also everything above its range.
+    static constexpr double kMinMicros = 0.01, kGrowth = 1.01;
+    static constexpr int kLatencyBuckets = 2560;
+
+    static int latencyBucket(double micros) {
+        if (micros <= kMinMicros) return 0;
+        return min(kLatencyBuckets - 1, 1 + (int)(log(micros / kMinMicros) / log(kGrowth)));
+    }
+
+    // Per-worker latency histogram; its mutex is only contended while stats() reads it.
+    struct LatencyLog {
+        mutex m;
+        vector<long long> buckets = vector<long long>(kLatencyBuckets, 0);
+        long long count = 0;
+        double maxMicros = 0;
+    };
+
+    void workerLoop(int tid) {
+        QueryWorkspace<int> ws;
+        vector<Pending> batch;
+        vector<double> done;
+        while (true) {
+            {
+                unique_lock<mutex> lock(queueMutex);
+                queueReady.wait(lock, [&] { return stopping || !queue.empty(); });
+                if (queue.empty()) return;  // stopping and drained
+                while (!queue.empty() && (int)batch.size() < batchLimit) {
+                    batch.push_back(move(queue.front()));
+                    queue.pop_front();
+                }
+            }
+            for (auto& p : batch) {
+                p.result.set_value(graph->answer(p.query, ws));
+                done.push_back(chrono::duration<double, micro>(chrono::steady_clock::now() - p.submitted).count());
+            }
+            batch.clear();
+            {
+                LatencyLog& hist = latencies[tid];
+                lock_guard<mutex> lock(hist.m);
+                for (double us : done) {
+                    hist.buckets[latencyBucket(us)]++;
+                    hist.maxMicros = max(hist.maxMicros, us);
+                }
+                hist.count += done.size();
+            }
+            done.clear();
+        }
+    }
+
+    shared_ptr<const SharedGraph> graph;
+    int batchLimit;
+    deque<Pending> queue;
+    mutex queueMutex;
+    condition_variable queueReady;
+    bool stopping = false;
+    vector<LatencyLog> latencies;
+    chrono::steady_clock::time_point statsStart;
+    vector<thread> workers;
+};
+
+#endif
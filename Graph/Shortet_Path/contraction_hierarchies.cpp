@@ -0,0 +1,635 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*
+ * Problem: Answer millions of shortest path queries on a static weighted directed graph far faster than
+ * rerunning Dijkstra per request.
+ *
+ * Approach (Contraction Hierarchies):
+ * 1. **Node ordering by edge difference**:
+ *    - Contracting node v removes it and adds a shortcut u -> x (weight w(u,v) + w(v,x)) for every in/out
+ *      neighbour pair whose shortest path goes through v.
+ *    - priority(v) = (#shortcuts needed - #edges removed) + #already contracted neighbours, so cheap,
+ *      "unimportant" nodes are contracted first and the hierarchy stays sparse and balanced.
+ *
+ * 2. **Witness searches**:
+ *    - A shortcut u -> x is only needed if there is no other path ("witness") from u to x of length
+ *      <= w(u,v) + w(v,x) avoiding v. This is checked with a Dijkstra from u bounded by that length and by a
+ *      settled-node limit (an aborted search just adds a harmless extra shortcut).
+ *
+ * 3. **Parallel contraction**:
+ *    - Each round contracts an independent set: every node whose (priority, id) is smaller than that of all its
+ *      remaining neighbours. Their witness searches run in parallel and ignore every node of the current batch,
+ *      so no shortcut relies on a node that is removed in the same round.
+ *    - Shortcuts are inserted sequentially, then the priorities of the touched neighbours are recomputed in parallel.
+ *
+ * 4. **Query**:
+ *    - After contraction every edge points either "up" (to a higher ranked node) or "down".
+ *    - A query runs Dijkstra forward from s over upward edges and backward from t over upward in-edges;
+ *      dist(s, t) = min over nodes m reached by both of df[m] + db[m]. Each side stops when its queue top
+ *      exceeds the best distance found. Shortcuts store their middle node, so the path is unpacked recursively.
+ *
+ * 5. **Serialization**:
+ *    - `save` / `load` write the ranks and the two upward CSR graphs in a flat binary format, so a service can
+ *      restart without re-running the preprocessing.
+ *
+ * Weights follow the dijkstra conventions: non-negative ints, unreachable targets get distance INT_MAX.
+ *
+ * Time Complexity:
+ * - Preprocessing: heuristic, typically O(V * (witness search cost)) — seconds to minutes for road networks.
+ * - Query: explores only the small upward search spaces (hundreds of nodes on road networks), O(S log S).
+ *
+ * Space Complexity:
+ * - **O(V + E + shortcuts)**; for road networks the shortcuts are about as many as the original edges.
+ */
+
+class ContractionHierarchy {
+public:
+    struct Result {
+        int distance = INT_MAX;  // INT_MAX when unreachable
+        vector<int> path;        // s ... t in original edges, empty when unreachable
+        int settled = 0;         // nodes expanded in both upward searches
+    };
+
+    ContractionHierarchy() = default;
+
+    // Builds the hierarchy from the dijkstra-style adjacency list adj[u] = {{v, w}, ...}.
+    void build(int V, vector<vector<int>> adj[], int threads = 0) {
+        n = V;
+        if (threads <= 0) threads = max(1u, thread::hardware_concurrency());
+        out.assign(n, {});
+        in.assign(n, {});
+        for (int u = 0; u < n; u++) {
+            for (auto& it : adj[u]) {
+                if (it[0] != u) addOrImprove(u, it[0], it[1], -1);  // Self loops never help a shortest path
+            }
+        }
+
+        rank.assign(n, -1);
+        deletedNeighbours.assign(n, 0);
+        priority.assign(n, 0);
+        upOut.assign(n, {});
+        upIn.assign(n, {});
+        shortcutCount = 0;
+        vector<WitnessScratch> scratch(threads);
+        for (auto& s : scratch) s.init(n);
+        vector<char> excluded(n, 0);
+
+        // Step 1: Initial priorities
+        vector<int> all(n);
+        iota(all.begin(), all.end(), 0);
+        parallelFor(all, threads, [&](int v, int tid) { priority[v] = computePriority(v, scratch[tid], excluded); });
+
+        int contracted = 0;
+        while (contracted < n) {
+            // Step 2: Independent set of local priority minima
+            vector<int> batch;
+            for (int v = 0; v < n; v++) {
+                if (rank[v] != -1) continue;
+                bool isMin = true;
+                for (auto* list : {&out[v], &in[v]}) {
+                    for (auto& e : *list) {
+                        if (make_pair(priority[e.other], e.other) < make_pair(priority[v], v)) {
+                            isMin = false;
+                            break;
+                        }
+                    }
+                    if (!isMin) break;
+                }
+                if (isMin) batch.push_back(v);
+            }
+
+            // Step 3: Witness searches for the whole batch in parallel
+            for (int v : batch) excluded[v] = 1;
+            vector<vector<Shortcut>> shortcuts(batch.size());
+            vector<int> slot(batch.size());
+            iota(slot.begin(), slot.end(), 0);
+            parallelFor(slot, threads, [&](int i, int tid) {
+                findShortcuts(batch[i], scratch[tid], excluded, shortcuts[i], kContractSettleLimit);
+            });
+            for (int v : batch) excluded[v] = 0;
+
+            // Step 4: Contract sequentially: freeze v's edges as up edges, detach it, insert shortcuts
+            vector<int> touched;
+            for (size_t i = 0; i < batch.size(); i++) {
+                int v = batch[i];
+                rank[v] = contracted++;
+                upOut[v] = out[v];
+                upIn[v] = in[v];
+                for (auto& e : out[v]) {
+                    removeEdge(in[e.other], v);
+                    deletedNeighbours[e.other]++;
+                    touched.push_back(e.other);
+                }
+                for (auto& e : in[v]) {
+                    removeEdge(out[e.other], v);
+                    deletedNeighbours[e.other]++;
+                    touched.push_back(e.other);
+                }
+                out[v].clear();
+                in[v].clear();
+                for (auto& s : shortcuts[i]) {
+                    if (addOrImprove(s.from, s.to, s.weight, v)) shortcutCount++;
+                }
+            }
+
+            // Step 5: Refresh the priorities of the neighbours of the contracted nodes
+            sort(touched.begin(), touched.end());
+            touched.erase(unique(touched.begin(), touched.end()), touched.end());
+            touched.erase(remove_if(touched.begin(), touched.end(), [&](int v) { return rank[v] != -1; }), touched.end());
+            parallelFor(touched, threads, [&](int v, int tid) { priority[v] = computePriority(v, scratch[tid], excluded); });
+        }
+
+        out.clear();
+        in.clear();
+        finalizeCsr();
+    }
+
+    Result query(int s, int t) {
+        Result res;
+        if (s < 0 || t < 0 || s >= n || t >= n) return res;
+        side[0].reset();
+        side[1].reset();
+        side[0].set(s, 0, -1, -1);
+        side[1].set(t, 0, -1, -1);
+        PQ pq[2];
+        pq[0].push({0, s});
+        pq[1].push({0, t});
+        long long best = INF;
+        int meet = -1;
+
+        while (!pq[0].empty() || !pq[1].empty()) {
+            int dir;
+            if (pq[0].empty()) dir = 1;
+            else if (pq[1].empty()) dir = 0;
+            else dir = pq[0].top().first <= pq[1].top().first ? 0 : 1;
+
+            auto [d, node] = pq[dir].top();
+            pq[dir].pop();
+            if (d >= best) {  // This side cannot improve the answer any more
+                pq[dir] = PQ();
+                continue;
+            }
+            if (d > side[dir].get(node)) continue;  // Stale entry
+            res.settled++;
+
+            long long other = side[dir ^ 1].get(node);
+            if (other != INF && d + other < best) {
+                best = d + other;
+                meet = node;
+            }
+
+            const Csr& g = dir == 0 ? upOutCsr : upInCsr;
+            for (int e = g.start[node]; e < g.start[node + 1]; e++) {
+                int v = g.to[e];
+                long long nd = d + g.weight[e];
+                if (nd < side[dir].get(v)) {
+                    side[dir].set(v, nd, node, e);
+                    pq[dir].push({nd, v});
+                }
+            }
+        }
+
+        if (meet == -1) return res;
+        res.distance = (int)min<long long>(best, INT_MAX);
+
+        // Upward path s -> meet (forward parents) and meet -> t (backward parents), then unpack shortcuts
+        vector<pair<int, int>> upEdges;  // (direction, CSR edge index) in s -> t order
+        for (int v = meet; side[0].parent[v] != -1; v = side[0].parent[v]) upEdges.push_back({0, side[0].edge[v]});
+        reverse(upEdges.begin(), upEdges.end());
+        for (int v = meet; side[1].parent[v] != -1; v = side[1].parent[v]) upEdges.push_back({1, side[1].edge[v]});
+
+        res.path.push_back(s);
+        int cur = s;
+        for (auto [dir, e] : upEdges) {
+            // Backward edges are stored at their lower endpoint; in s -> t order they lead from the
+            // higher node (cur) down to that lower endpoint.
+            int next = dir == 0 ? upOutCsr.to[e] : lowerEndOfIn[e];
+            unpack(cur, next, dir == 0 ? upOutCsr.middle[e] : upInCsr.middle[e], res.path);
+            cur = next;
+        }
+        return res;
+    }
+
+    int shortcuts() const { return shortcutCount; }
+    int nodes() const { return n; }
+
+    // Flat binary format: magic, n, ranks, then the two upward CSR graphs. `load` returns false (and keeps the
+    // current hierarchy) on a truncated or inconsistent stream: counts must match n, CSR offsets must be monotone
+    // and in range, edges must point to higher ranks and shortcut middles to lower ones (so unpacking terminates).
+    void save(ostream& os) const {
+        const uint32_t magic = 0x43483031;  // "CH01"
+        write(os, magic);
+        write(os, n);
+        write(os, shortcutCount);
+        writeVec(os, rank);
+        for (const Csr* g : {&upOutCsr, &upInCsr}) {
+            writeVec(os, g->start);
+            writeVec(os, g->to);
+            writeVec(os, g->weight);
+            writeVec(os, g->middle);
+        }
+    }
+
+    bool load(istream& is) {
+        uint32_t magic = 0;
+        int nodes = -1, count = -1;
+        read(is, magic);
+        if (!is || magic != 0x43483031) return false;
+        read(is, nodes);
+        read(is, count);
+        if (!is || nodes < 0 || nodes == INT_MAX || count < 0) return false;
+        vector<int> ranks;
+        Csr g[2];
+        if (!readVec(is, ranks, nodes)) return false;
+        for (int v = 0; v < nodes; v++)
+            if (ranks[v] < 0 || ranks[v] >= nodes) return false;
+        for (Csr& c : g) {
+            if (!readVec(is, c.start, nodes + 1) || !readVec(is, c.to) || !readVec(is, c.weight, c.to.size()) ||
+                !readVec(is, c.middle, c.to.size()) || !consistent(nodes, ranks, c))
+                return false;
+        }
+        n = nodes;
+        shortcutCount = count;
+        rank = move(ranks);
+        upOutCsr = move(g[0]);
+        upInCsr = move(g[1]);
+        rebuildDerived();
+        return true;
+    }
+
+private:
+    static constexpr long long INF = LLONG_MAX / 4;
+    // Witness search budgets; exceeding one only adds an unnecessary (but correct) shortcut.
+    static constexpr int kContractSettleLimit = 500;  // When actually contracting
+    static constexpr int kPrioritySettleLimit = 40;   // When only estimating the edge difference
+    using PQ = priority_queue<pair<long long, int>, vector<pair<long long, int>>, greater<pair<long long, int>>>;
+
+    struct Edge {
+        int other, weight, middle;  // middle = contracted node this shortcut bypasses, -1 for original edges
+    };
+    struct Shortcut {
+        int from, to, weight;
+    };
+    struct Csr {
+        vector<int> start, to, weight, middle;
+    };
+
+    struct WitnessScratch {
+        vector<long long> dist;
+        vector<unsigned> stamp, targetStamp;
+        vector<pair<long long, int>> heap;  // Reused min-heap storage (one witness search allocates nothing)
+        unsigned query = 0;
+        void init(int n) {
+            dist.assign(n, INF);
+            stamp.assign(n, 0);
+            targetStamp.assign(n, 0);
+        }
+        void reset() {
+            if (++query == 0) {
+                fill(stamp.begin(), stamp.end(), 0);
+                fill(targetStamp.begin(), targetStamp.end(), 0);
+                query = 1;
+            }
+        }
+        // Returns true if x was not yet marked as a target of the current search.
+        bool markTarget(int x) {
+            if (targetStamp[x] == query) return false;
+            targetStamp[x] = query;
+            return true;
+        }
+        bool isTarget(int x) const { return targetStamp[x] == query; }
+        long long get(int v) const { return stamp[v] == query ? dist[v] : INF; }
+        void set(int v, long long d) {
+            stamp[v] = query;
+            dist[v] = d;
+        }
+    };
+
+    struct QueryScratch {
+        vector<long long> dist;
+        vector<int> parent, edge;
+        vector<unsigned> stamp;
+        unsigned query = 0;
+        void init(int n) {
+            dist.assign(n, INF);
+            parent.assign(n, -1);
+            edge.assign(n, -1);
+            stamp.assign(n, 0);
+        }
+        void reset() {
+            if (++query == 0) {
+                fill(stamp.begin(), stamp.end(), 0);
+                query = 1;
+            }
+        }
+        long long get(int v) const { return stamp[v] == query ? dist[v] : INF; }
+        void set(int v, long long d, int p, int e) {
+            stamp[v] = query;
+            dist[v] = d;
+            parent[v] = p;
+            edge[v] = e;
+        }
+    };
+
+    // Adds u -> v or lowers its weight; returns true if a new edge was created.
+    bool addOrImprove(int u, int v, int w, int middle) {
+        for (auto& e : out[u]) {
+            if (e.other == v) {
+                if (w < e.weight) {
+                    e.weight = w;
+                    e.middle = middle;
+                    for (auto& r : in[v]) {
+                        if (r.other == u) {
+                            r.weight = w;
+                            r.middle = middle;
+                        }
+                    }
+                }
+                return false;
+            }
+        }
+        out[u].push_back({v, w, middle});
+        in[v].push_back({u, w, middle});
+        return true;
+    }
+
+    static void removeEdge(vector<Edge>& list, int other) {
+        for (size_t i = 0; i < list.size(); i++) {
+            if (list[i].other == other) {
+                list[i] = list.back();
+                list.pop_back();
+                return;
+            }
+        }
+    }
+
+    // Collects the shortcuts contracting v would need (with witness searches that avoid `excluded` nodes and v).
+    void findShortcuts(int v, WitnessScratch& ws, const vector<char>& excluded, vector<Shortcut>& result,
+                       int settleLimit) {
+        for (auto& ein : in[v]) {
+            int u = ein.other;
+            ws.reset();
+            long long maxLen = 0;
+            int targets = 0;
+            for (auto& eout : out[v]) {
+                if (eout.other == u) continue;
+                maxLen = max<long long>(maxLen, (long long)ein.weight + eout.weight);
+                if (ws.markTarget(eout.other)) targets++;
+            }
+            if (targets == 0) continue;
+
+            // Bounded Dijkstra from u on the remaining graph without v; stops once every target is settled
+            ws.set(u, 0);
+            auto& heap = ws.heap;
+            heap.clear();
+            heap.push_back({0, u});
+            int settled = 0;
+            while (!heap.empty() && settled < settleLimit && targets > 0) {
+                pop_heap(heap.begin(), heap.end(), greater<pair<long long, int>>());
+                auto [d, x] = heap.back();
+                heap.pop_back();
+                if (d > ws.get(x)) continue;
+                if (d > maxLen) break;
+                settled++;
+                if (ws.isTarget(x)) targets--;
+                for (auto& e : out[x]) {
+                    if (e.other == v || excluded[e.other]) continue;
+                    long long nd = d + e.weight;
+                    if (nd < ws.get(e.other)) {
+                        ws.set(e.other, nd);
+                        heap.push_back({nd, e.other});
+                        push_heap(heap.begin(), heap.end(), greater<pair<long long, int>>());
+                    }
+                }
+            }
+
+            for (auto& eout : out[v]) {
+                int x = eout.other;
+                if (x == u) continue;
+                long long viaV = (long long)ein.weight + eout.weight;
+                if (ws.get(x) > viaV) {
+                    result.push_back({u, x, (int)min<long long>(viaV, INT_MAX - 1)});
+                }
+            }
+        }
+    }
+
+    int computePriority(int v, WitnessScratch& ws, const vector<char>& excluded) {
+        vector<Shortcut> tmp;
+        findShortcuts(v, ws, excluded, tmp, kPrioritySettleLimit);
+        int edgeDifference = (int)tmp.size() - (int)(in[v].size() + out[v].size());
+        return edgeDifference + deletedNeighbours[v];
+    }
+
+    template <class F>
+    static void parallelFor(const vector<int>& items, int threads, F fn) {
+        if (threads <= 1 || items.size() < 256) {
+            for (int v : items) fn(v, 0);
+            return;
+        }
+        atomic<size_t> next(0);
+        vector<thread> pool;
+        for (int t = 0; t < threads; t++) {
+            pool.emplace_back([&, t] {
+                const size_t chunk = 64;
+                for (size_t i = next.fetch_add(chunk); i < items.size(); i = next.fetch_add(chunk)) {
+                    for (size_t j = i; j < min(items.size(), i + chunk); j++) fn(items[j], t);
+                }
+            });
+        }
+        for (auto& th : pool) th.join();
+    }
+
+    void finalizeCsr() {
+        for (int dir = 0; dir < 2; dir++) {
+            auto& lists = dir == 0 ? upOut : upIn;
+            Csr& g = dir == 0 ? upOutCsr : upInCsr;
+            g.start.assign(n + 1, 0);
+            for (int v = 0; v < n; v++) g.start[v + 1] = g.start[v] + lists[v].size();
+            g.to.resize(g.start[n]);
+            g.weight.resize(g.start[n]);
+            g.middle.resize(g.start[n]);
+            for (int v = 0; v < n; v++) {
+                int pos = g.start[v];
+                for (auto& e : lists[v]) {
+                    g.to[pos] = e.other;
+                    g.weight[pos] = e.weight;
+                    g.middle[pos++] = e.middle;
+                }
+            }
+        }
+        upOut.clear();
+        upIn.clear();
+        rebuildDerived();
+    }
+
+    // Query scratch and the lookup tables used for path unpacking.
+    void rebuildDerived() {
+        side[0].init(n);
+        side[1].init(n);
+        lowerEndOfIn.assign(upInCsr.to.size(), 0);
+        for (int v = 0; v < n; v++)
+            for (int e = upInCsr.start[v]; e < upInCsr.start[v + 1]; e++) lowerEndOfIn[e] = v;
+    }
+
+    // Appends the original-edge path from a (exclusive) to b (inclusive) for edge a -> b with the given middle node.
+    void unpack(int a, int b, int middle, vector<int>& path) const {
+        if (middle == -1) {
+            path.push_back(b);
+            return;
+        }
+        // a -> middle is an upward in-edge of middle, middle -> b an upward out-edge of middle
+        unpack(a, middle, findMiddle(upInCsr, middle, a), path);
+        unpack(middle, b, findMiddle(upOutCsr, middle, b), path);
+    }
+
+    static int findMiddle(const Csr& g, int node, int other) {
+        int best = -1, bestW = INT_MAX;
+        for (int e = g.start[node]; e < g.start[node + 1]; e++) {
+            if (g.to[e] == other && g.weight[e] < bestW) {
+                bestW = g.weight[e];
+                best = g.middle[e];
+            }
+        }
+        return best;
+    }
+
+    template <class T>
+    static void write(ostream& os, const T& value) {
+        os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+    template <class T>
+    static void read(istream& is, T& value) {
+        is.read(reinterpret_cast<char*>(&value), sizeof(T));
+    }
+    static void writeVec(ostream& os, const vector<int>& v) {
+        uint64_t size = v.size();
+        write(os, size);
+        os.write(reinterpret_cast<const char*>(v.data()), size * sizeof(int));
+    }
+    // Reads a length-prefixed vector; false if the stream ends early or the length is not `expected` (when given).
+    // Grows in chunks, so a corrupt length fails at end of stream instead of allocating it up front.
+    static bool readVec(istream& is, vector<int>& v, long long expected = -1) {
+        uint64_t size = 0;
+        read(is, size);
+        if (!is || size > (uint64_t)INT_MAX || (expected >= 0 && size != (uint64_t)expected)) return false;
+        v.clear();
+        while (v.size() < size) {
+            size_t done = v.size(), step = min<size_t>(size - done, size_t(1) << 20);
+            v.resize(done + step);
+            is.read(reinterpret_cast<char*>(v.data() + done), step * sizeof(int));
+            if (!is) return false;
+        }
+        return true;
+    }
+
+    // Offsets 0 .. to.size() non-decreasing, targets ranked above their source, middles below it.
+    static bool consistent(int n, const vector<int>& rank, const Csr& g) {
+        if (g.start[0] != 0 || g.start[n] != (int)g.to.size()) return false;
+        for (int v = 0; v < n; v++) {
+            if (g.start[v + 1] < g.start[v]) return false;
+            for (int e = g.start[v]; e < g.start[v + 1]; e++) {
+                int u = g.to[e], m = g.middle[e];
+                if (u < 0 || u >= n || rank[u] <= rank[v] || g.weight[e] < 0) return false;
+                if (m != -1 && (m < 0 || m >= n || rank[m] >= rank[v])) return false;
+            }
+        }
+        return true;
+    }
+
+    int n = 0;
+    int shortcutCount = 0;
+    vector<int> rank, priority, deletedNeighbours;
+    vector<vector<Edge>> out, in;       // Remaining graph during contraction
+    vector<vector<Edge>> upOut, upIn;   // Frozen edges of contracted nodes (before CSR conversion)
+    Csr upOutCsr, upInCsr;              // upInCsr[v] lists higher ranked u with an edge u -> v
+    vector<int> lowerEndOfIn;           // For an upInCsr edge index: the lower ranked endpoint
+    QueryScratch side[2];
+};
+
+vector<int> referenceDijkstra(int V, vector<vector<int>> adj[], int S) {
+    vector<int> distTo(V, INT_MAX);
+    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> pq;
+    distTo[S] = 0;
+    pq.push({0, S});
+    while (!pq.empty()) {
+        auto [dis, node] = pq.top();
+        pq.pop();
+        if (dis > distTo[node]) continue;
+        for (auto& it : adj[node]) {
+            if (dis + it[1] < distTo[it[0]]) {
+                distTo[it[0]] = dis + it[1];
+                pq.push({distTo[it[0]], it[0]});
+            }
+        }
+    }
+    return distTo;
+}
+
+int main() {
+    // Road-like test graph: a 60x60 grid with random weights in both directions plus a few random long edges
+    int side = 60, V = side * side;
+    mt19937 rng(11);
+    vector<vector<int>> adj[V];
+    auto addEdge = [&](int u, int v) { adj[u].push_back({v, (int)(rng() % 50) + 1}); };
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            int id = r * side + c;
+            if (c + 1 < side) { addEdge(id, id + 1); addEdge(id + 1, id); }
+            if (r + 1 < side) { addEdge(id, id + side); addEdge(id + side, id); }
+        }
+    }
+    for (int i = 0; i < V / 20; i++) addEdge(rng() % V, rng() % V);
+
+    ContractionHierarchy ch;
+    auto t0 = chrono::steady_clock::now();
+    ch.build(V, adj);
+    auto t1 = chrono::steady_clock::now();
+    cout << "Built CH with " << ch.shortcuts() << " shortcuts in "
+         << chrono::duration<double, milli>(t1 - t0).count() << " ms" << endl;
+
+    // Serialization round trip
+    stringstream buffer;
+    ch.save(buffer);
+    ContractionHierarchy restored;
+    cout << "Reloaded: " << (restored.load(buffer) ? "yes" : "no") << endl;
+
+    // A truncated stream and an out-of-range edge target (the first upOut `to` entry) are rejected
+    string bytes = buffer.str();
+    stringstream truncated(bytes.substr(0, bytes.size() / 2));
+    string corrupt = bytes;
+    int badTarget = V + 7;
+    memcpy(&corrupt[12 + (8 + 4 * V) + (8 + 4 * (V + 1)) + 8], &badTarget, sizeof(int));
+    stringstream corrupted(corrupt);
+    ContractionHierarchy rejected;
+    bool truncatedLoaded = rejected.load(truncated), corruptLoaded = rejected.load(corrupted);
+    cout << "Truncated stream: " << (truncatedLoaded ? "ACCEPTED" : "rejected")
+         << ", corrupt target: " << (corruptLoaded ? "ACCEPTED" : "rejected") << endl;
+
+    int mismatches = 0, queries = 300;
+    long long settled = 0;
+    for (int q = 0; q < queries; q++) {
+        int s = rng() % V, t = rng() % V;
+        int expected = referenceDijkstra(V, adj, s)[t];
+        auto res = restored.query(s, t);
+        settled += res.settled;
+        bool ok = res.distance == expected;
+        if (ok && expected != INT_MAX) {
+            long long len = 0;
+            ok = res.path.front() == s && res.path.back() == t;
+            for (size_t i = 0; ok && i + 1 < res.path.size(); i++) {
+                int w = INT_MAX;
+                for (auto& it : adj[res.path[i]])
+                    if (it[0] == res.path[i + 1]) w = min(w, it[1]);
+                ok = w != INT_MAX;
+                len += w;
+            }
+            ok = ok && len == expected;
+        }
+        if (!ok) mismatches++;
+    }
+    cout << "Mismatches: " << mismatches << ", average settled nodes per query: " << settled / queries
+         << " (of " << V << ")" << endl;
+    return 0;
+}
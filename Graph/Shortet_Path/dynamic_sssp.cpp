@@ -0,0 +1,264 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+#include "../Instrumentation/graph_counters.h"
+#include "../Weights/weight_traits.h"
+#include "../Workspace/query_workspace.h"
+namespace dijkstra_impl {
+#include "dijkstras_positive_weights.cpp"
+}
+
+/*
+ * Problem: Keep single-source shortest distances up to date while individual edges are inserted, deleted or change
+ * weight (e.g. traffic updates), instead of rerunning Solution::dijkstra over the whole graph after every change.
+ *
+ * Approach (Ramalingam-Reps style repair of the shortest path tree):
+ * 1. **State**:
+ *    - `distTo[]` (as dijkstra returns it) plus the shortest path tree `parent[]`, built once by a full Dijkstra.
+ *    - Out- and in-adjacency lists, so a node's best incoming edge can be re-evaluated.
+ *    - At most one edge per ordered pair (u, v); `setEdge` inserts or overwrites it, `removeEdge` deletes it.
+ *      Parallel edges in the constructor's input collapse to the lightest one, the one dijkstra would use.
+ *
+ * 2. **Every update is a weight change** old -> new (a missing edge has weight infinity):
+ *
+ * 3. **Decrease** (insert, or new < old):
+ *    - If distTo[u] + new < distTo[v], v improves through u; run Dijkstra seeded with v only. It only ever pushes
+ *      nodes whose distance strictly improves, so it stays inside the region the change actually shortens.
+ *
+ * 4. **Increase** (delete, or new > old):
+ *    - If u -> v is not v's tree edge, no shortest distance depends on it: done.
+ *    - Otherwise the affected nodes are v's subtree in the shortest path tree (every other node keeps a tree path that
+ *      avoids the edge). Collect the subtree, give each affected node its best tentative distance through an edge from
+ *      an unaffected node (or infinity), and run Dijkstra restricted to the affected nodes.
+ *    - Distances outside the subtree cannot change: the update only makes paths longer.
+ *
+ * 5. **Cost**:
+ *    - `lastTouched()` reports how many nodes the last update examined, which is proportional to the changed region
+ *      (plus their in-edges for increases) rather than to V.
+ *
+ * Time Complexity:
+ * - Build: **O(E log V)** (one Dijkstra).
+ * - Update: **O(1)** when the edge is irrelevant, else **O((|R| + |E(R)|) log |R|)** where R is the affected region.
+ *
+ * Space Complexity:
+ * - **O(V + E)** for the two adjacency lists, distances and tree.
+ *
+ * Weights must be non-negative (same restriction as dijkstra). Unreachable nodes have distance `Traits::infinity()`
+ * (INT_MAX for int) and parent -1.
+ */
+
+template <class Weight = int, class Traits = WeightTraits<Weight>>
+class DynamicSssp {
+public:
+    // adj[u] = {{v, w}, ...}: the dijkstra input format.
+    DynamicSssp(int V, vector<vector<Weight>> adj[], int source) : n(V), src(source), out(V), in(V) {
+        for (int u = 0; u < n; u++) {
+            for (auto& it : adj[u])
+                if (it[1] < weight(u, it[0])) setWeight(u, it[0], it[1]);
+        }
+        recomputeAll();
+    }
+
+    // Inserts u -> v with weight w, or changes its weight if it already exists.
+    void setEdge(int u, int v, Weight w) { update(u, v, w); }
+
+    // Deletes u -> v (no-op if it does not exist).
+    void removeEdge(int u, int v) { update(u, v, Traits::infinity()); }
+
+    Weight distance(int v) const { return distTo[v]; }
+    const vector<Weight>& distances() const { return distTo; }
+    int parentOf(int v) const { return parent[v]; }
+    int lastTouched() const { return touched; }
+
+    // Source ... v along the shortest path tree, empty when v is unreachable.
+    vector<int> path(int v) const {
+        vector<int> nodes;
+        if (distTo[v] == Traits::infinity()) return nodes;
+        for (; v != -1; v = parent[v]) nodes.push_back(v);
+        reverse(nodes.begin(), nodes.end());
+        return nodes;
+    }
+
+private:
+    using PQ = priority_queue<pair<Weight, int>, vector<pair<Weight, int>>, greater<pair<Weight, int>>>;
+
+    void update(int u, int v, Weight w) {
+        touched = 0;
+        Weight old = setWeight(u, v, w);
+        if (w < old) {
+            // Step 3: Decrease
+            Weight nd = Traits::add(distTo[u], w);
+            if (nd < distTo[v]) {
+                distTo[v] = nd;
+                parent[v] = u;
+                PQ pq;
+                pq.push({nd, v});
+                propagate(pq, nullptr);
+            }
+        } else if (w > old && parent[v] == u) {
+            // Step 4: Increase of a tree edge
+            repairSubtree(v);
+        }
+    }
+
+    // Current weight of u -> v, infinity if absent.
+    Weight weight(int u, int v) const {
+        for (auto& [x, w] : out[u])
+            if (x == v) return w;
+        return Traits::infinity();
+    }
+
+    // Stores w for u -> v (infinity removes the edge) and returns the previous weight (infinity if absent).
+    Weight setWeight(int u, int v, Weight w) {
+        Weight old = Traits::infinity();
+        auto assign = [&](vector<pair<int, Weight>>& list, int other) {
+            for (size_t i = 0; i < list.size(); i++) {
+                if (list[i].first != other) continue;
+                old = list[i].second;
+                if (w == Traits::infinity()) {
+                    list[i] = list.back();
+                    list.pop_back();
+                } else {
+                    list[i].second = w;
+                }
+                return;
+            }
+            if (w != Traits::infinity()) list.push_back({other, w});
+        };
+        assign(out[u], v);
+        assign(in[v], u);
+        return old;
+    }
+
+    void recomputeAll() {
+        distTo.assign(n, Traits::infinity());
+        parent.assign(n, -1);
+        distTo[src] = 0;
+        PQ pq;
+        pq.push({0, src});
+        propagate(pq, nullptr);
+    }
+
+    // Dijkstra from the queued nodes; with `region`, only nodes flagged in it may be relaxed.
+    void propagate(PQ& pq, const vector<char>* region) {
+        while (!pq.empty()) {
+            auto [dis, node] = pq.top();
+            pq.pop();
+            if (dis > distTo[node]) continue;  // Stale entry
+            touched++;
+            for (auto& [v, w] : out[node]) {
+                if (region && !(*region)[v]) continue;
+                Weight nd = Traits::add(dis, w);
+                if (nd < distTo[v]) {
+                    distTo[v] = nd;
+                    parent[v] = node;
+                    pq.push({nd, v});
+                }
+            }
+        }
+    }
+
+    void repairSubtree(int root) {
+        // Collect the shortest path subtree hanging below root
+        vector<int> affected = {root};
+        inRegion.resize(n, 0);
+        inRegion[root] = 1;
+        for (size_t i = 0; i < affected.size(); i++) {
+            int x = affected[i];
+            for (auto& [y, w] : out[x]) {
+                if (parent[y] == x && !inRegion[y]) {
+                    inRegion[y] = 1;
+                    affected.push_back(y);
+                }
+            }
+        }
+
+        // Best tentative distance through an unaffected predecessor
+        PQ pq;
+        for (int x : affected) {
+            distTo[x] = Traits::infinity();
+            parent[x] = -1;
+        }
+        for (int x : affected) {
+            for (auto& [y, w] : in[x]) {
+                if (inRegion[y]) continue;
+                Weight nd = Traits::add(distTo[y], w);
+                if (nd < distTo[x]) {
+                    distTo[x] = nd;
+                    parent[x] = y;
+                }
+            }
+            if (distTo[x] != Traits::infinity()) pq.push({distTo[x], x});
+        }
+
+        // Settle the region; nodes outside it keep their distances
+        propagate(pq, &inRegion);
+        touched = max<int>(touched, affected.size());
+        for (int x : affected) inRegion[x] = 0;
+    }
+
+    int n, src;
+    vector<vector<pair<int, Weight>>> out, in;
+    vector<Weight> distTo;
+    vector<int> parent;
+    vector<char> inRegion;  // Scratch: membership of the subtree being repaired
+    int touched = 0;
+};
+
+int main() {
+    // 80x80 grid with random weights; apply random insertions, deletions and weight changes and compare
+    // against a full dijkstra after every update.
+    int side = 80, V = side * side;
+    mt19937 rng(21);
+    vector<vector<int>> adj[V];
+    auto setAdj = [&](int u, int v, int w) {
+        for (auto& it : adj[u])
+            if (it[0] == v) { it[1] = w; return; }
+        adj[u].push_back({v, w});
+    };
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            int id = r * side + c;
+            if (c + 1 < side) { setAdj(id, id + 1, rng() % 50 + 1); setAdj(id + 1, id, rng() % 50 + 1); }
+            if (r + 1 < side) { setAdj(id, id + side, rng() % 50 + 1); setAdj(id + side, id, rng() % 50 + 1); }
+        }
+    }
+
+    DynamicSssp<int> sssp(V, adj, 0);
+    int updates = 500, mismatches = 0;
+    long long touched = 0;
+    for (int i = 0; i < updates; i++) {
+        int u = rng() % V;
+        int kind = rng() % 3;
+        if (kind == 2 && !adj[u].empty()) {
+            // Delete an existing edge
+            int k = rng() % adj[u].size();
+            int v = adj[u][k][0];
+            adj[u].erase(adj[u].begin() + k);
+            sssp.removeEdge(u, v);
+        } else if (kind == 1) {
+            // Insert a random shortcut
+            int v = rng() % V, w = rng() % 200 + 1;
+            if (v == u) continue;
+            setAdj(u, v, w);
+            sssp.setEdge(u, v, w);
+        } else if (!adj[u].empty()) {
+            // Change the weight of an existing edge
+            int k = rng() % adj[u].size(), w = rng() % 50 + 1;
+            adj[u][k][1] = w;
+            sssp.setEdge(u, adj[u][k][0], w);
+        }
+        touched += sssp.lastTouched();
+        if (sssp.distances() != dijkstra_impl::Solution().dijkstra(V, adj, 0)) mismatches++;
+    }
+    cout << "Updates: " << updates << ", mismatches: " << mismatches
+         << ", average nodes touched per update: " << touched / updates << " (of " << V << ")" << endl;
+
+    // Parallel edges: the constructor keeps the lightest of each pair, whatever their order
+    vector<vector<int>> multi[3] = {{{1, 9}, {1, 2}, {1, 5}, {2, 1}}, {{2, 7}, {2, 1}}, {}};
+    DynamicSssp<int> parallel(3, multi, 0);
+    bool same = parallel.distances() == dijkstra_impl::Solution().dijkstra(3, multi, 0);
+    cout << "Parallel edges: distances " << parallel.distance(1) << " " << parallel.distance(2) << ", "
+         << (same ? "match" : "MISMATCH") << endl;
+    return 0;
+}
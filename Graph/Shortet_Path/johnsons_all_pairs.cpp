@@ -0,0 +1,193 @@
+#include <bits/stdc++.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+using namespace std;
+
+#include "../Instrumentation/graph_counters.h"
+#include "../Weights/weight_traits.h"
+#include "../Workspace/query_workspace.h"
+namespace bellman_ford_impl {
+#include "bellmonford_negative_weights.cpp"
+}
+namespace dijkstra_impl {
+#include "dijkstras_positive_weights.cpp"
+}
+
+/*
+ * Problem: All-pairs shortest paths on a large sparse directed graph that may contain negative edge weights
+ * (but no negative cycles), where Floyd-Warshall's O(V^3) time and dense V x V matrix are not an option.
+ *
+ * Approach (Johnson's algorithm):
+ * 1. **Potentials with Bellman-Ford**:
+ *    - Add a virtual vertex V with a 0-weight edge to every vertex and run Solution::bellmanFord from it.
+ *    - The result h[] is a feasible potential: for every edge u -> v, h[v] <= h[u] + w(u, v).
+ *    - If bellmanFord reports a negative cycle ({-1}), shortest paths are undefined and no rows are produced.
+ *
+ * 2. **Reweighting**:
+ *    - w'(u, v) = w(u, v) + h[u] - h[v] >= 0, so every edge becomes non-negative and Dijkstra applies.
+ *    - Every s -> t path changes length by the same h[s] - h[t], so shortest paths are preserved and
+ *      d(s, t) = d'(s, t) - h[s] + h[t].
+ *
+ * 3. **One Dijkstra per source, in parallel**:
+ *    - Solution::dijkstra runs on the reweighted adjacency list once per source. Sources are handed out to a
+ *      pool of worker threads through an atomic counter; the graph is shared read-only.
+ *
+ * 4. **Streaming output** (the V x V matrix is never held in RAM):
+ *    - `forEachRow(threads, onRow)` hands every finished row to the callback and then drops it.
+ *    - `writeMatrixFile(path, threads)` memory-maps a V * V int32 row-major file and workers write their rows
+ *      straight into the mapping, so the kernel pages the matrix out instead of the process holding it.
+ *
+ * Output contract (same as Solution::dijkstra): row s holds d(s, t) as an int, INT_MAX when t is unreachable.
+ *
+ * Time Complexity:
+ * - **O(V * E)** for the Bellman-Ford potentials (once per graph).
+ * - **O(V * E * log V)** for the V Dijkstra runs, divided across the worker threads.
+ *
+ * Space Complexity:
+ * - **O(V + E)** for the reweighted graph, plus **O(V)** per worker for the row being computed.
+ *
+ * The reweighted edge weights and distances are ints like everywhere else in Shortet_Path, so
+ * |h[v]| + max |w| and the reweighted path lengths must stay below INT_MAX.
+ */
+
+class JohnsonAllPairs {
+public:
+    // edges[i] = {u, v, w}, the bellmanFord input format.
+    JohnsonAllPairs(int V, vector<vector<int>>& edges) : n(V), adj(V) {
+        // Step 1: Potentials from the virtual vertex V
+        vector<vector<int>> withSource = edges;
+        for (int v = 0; v < n; v++) withSource.push_back({n, v, 0});
+        vector<int> dist = bellman_ford_impl::Solution().bellmanFord(n + 1, withSource, n);
+        if (dist.size() == 1 && dist[0] == -1) {
+            negativeCycle = true;
+            return;
+        }
+        h.assign(dist.begin(), dist.begin() + n);
+
+        // Step 2: Reweight every edge to a non-negative weight
+        for (auto& it : edges) {
+            adj[it[0]].push_back({it[1], it[2] + h[it[0]] - h[it[1]]});
+        }
+    }
+
+    bool hasNegativeCycle() const { return negativeCycle; }
+
+    // Computes every source's row on `threads` workers; onRow(s, row) is called once per source, in no particular
+    // order, one call at a time (calls are serialized, so the callback needs no locking of its own).
+    void forEachRow(int threads, const function<void(int, const vector<int>&)>& onRow) {
+        mutex lock;
+        runSources(threads, [&](int s, const vector<int>& row) {
+            lock_guard<mutex> guard(lock);
+            onRow(s, row);
+        });
+    }
+
+    // Writes the V x V int32 matrix (row-major, native endianness) to `path` through a shared memory mapping.
+    // Returns false if the graph has a negative cycle or the file cannot be created / mapped.
+    bool writeMatrixFile(const string& path, int threads) {
+        if (negativeCycle) return false;
+        size_t bytes = size_t(n) * n * sizeof(int32_t);
+        int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) return false;
+        if (ftruncate(fd, bytes) != 0) {
+            close(fd);
+            return false;
+        }
+        void* base = bytes ? mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : nullptr;
+        if (base == MAP_FAILED) {
+            close(fd);
+            return false;
+        }
+        int32_t* matrix = static_cast<int32_t*>(base);
+        // Every worker owns distinct rows, so the writes need no synchronization.
+        runSources(threads, [&](int s, const vector<int>& row) {
+            memcpy(matrix + size_t(s) * n, row.data(), n * sizeof(int32_t));
+        });
+        if (bytes) munmap(base, bytes);
+        close(fd);
+        return true;
+    }
+
+private:
+    // Step 3 + 4: Dijkstra on the reweighted graph from every source, undoing the reweighting per row.
+    void runSources(int threads, const function<void(int, const vector<int>&)>& emit) {
+        if (negativeCycle) return;
+        atomic<int> next(0);
+        auto worker = [&] {
+            dijkstra_impl::Solution solver;
+            for (int s = next++; s < n; s = next++) {
+                vector<int> row = solver.dijkstra(n, adj.data(), s);
+                for (int t = 0; t < n; t++) {
+                    if (row[t] != INT_MAX) row[t] = row[t] - h[s] + h[t];
+                }
+                emit(s, row);
+            }
+        };
+        threads = max(1, min(threads, n));
+        vector<thread> pool;
+        for (int t = 1; t < threads; t++) pool.emplace_back(worker);
+        worker();
+        for (auto& th : pool) th.join();
+    }
+
+    int n;
+    bool negativeCycle = false;
+    vector<int> h;                       // Bellman-Ford potentials
+    vector<vector<vector<int>>> adj;     // Reweighted graph in the dijkstra format: adj[u] = {{v, w'}, ...}
+};
+
+int main() {
+    // Random sparse graph with negative edges but no negative cycle: w = base + p[u] - p[v] with base >= 0.
+    int V = 300;
+    mt19937 rng(5);
+    vector<int> p(V);
+    for (int& x : p) x = rng() % 200;
+    vector<vector<int>> edges;
+    for (int u = 0; u < V; u++) {
+        for (int k = 0; k < 4; k++) {
+            int v = rng() % V;
+            if (v != u) edges.push_back({u, v, (int)(rng() % 50) + p[u] - p[v]});
+        }
+    }
+
+    // Reference: Floyd-Warshall in long long with explicit infinity handling.
+    const long long INF = LLONG_MAX / 4;
+    vector<vector<long long>> ref(V, vector<long long>(V, INF));
+    for (int i = 0; i < V; i++) ref[i][i] = 0;
+    for (auto& e : edges) ref[e[0]][e[1]] = min<long long>(ref[e[0]][e[1]], e[2]);
+    for (int k = 0; k < V; k++)
+        for (int i = 0; i < V; i++)
+            if (ref[i][k] < INF)
+                for (int j = 0; j < V; j++)
+                    if (ref[k][j] < INF) ref[i][j] = min(ref[i][j], ref[i][k] + ref[k][j]);
+
+    JohnsonAllPairs johnson(V, edges);
+    int mismatches = 0, rows = 0;
+    johnson.forEachRow(4, [&](int s, const vector<int>& row) {
+        rows++;
+        for (int t = 0; t < V; t++) {
+            long long expected = ref[s][t] >= INF ? INT_MAX : ref[s][t];
+            if (row[t] != expected) mismatches++;
+        }
+    });
+    cout << "Rows: " << rows << ", mismatches: " << mismatches << endl;
+
+    // Memory-mapped output must hold the same matrix.
+    string path = "/tmp/johnson_matrix.bin";
+    bool written = johnson.writeMatrixFile(path, 4);
+    ifstream in(path, ios::binary);
+    vector<int32_t> file(size_t(V) * V);
+    in.read(reinterpret_cast<char*>(file.data()), file.size() * sizeof(int32_t));
+    int fileMismatches = 0;
+    for (int s = 0; s < V; s++)
+        for (int t = 0; t < V; t++)
+            if (file[size_t(s) * V + t] != (ref[s][t] >= INF ? INT_MAX : ref[s][t])) fileMismatches++;
+    cout << "Matrix file written: " << (written ? "yes" : "no") << ", mismatches: " << fileMismatches << endl;
+    remove(path.c_str());
+
+    // A negative cycle must be reported instead of producing rows.
+    vector<vector<int>> cyclic = {{0, 1, 2}, {1, 2, -3}, {2, 0, 0}};
+    cout << "Negative cycle detected: " << (JohnsonAllPairs(3, cyclic).hasNegativeCycle() ? "yes" : "no") << endl;
+    return 0;
+}
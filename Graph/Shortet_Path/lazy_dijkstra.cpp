@@ -0,0 +1,252 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+#include "../Instrumentation/graph_counters.h"
+#include "../Weights/weight_traits.h"
+#include "../Workspace/query_workspace.h"
+#include "../Memory/numa_memory.h"
+namespace dijkstra_impl {
+#include "dijkstras_positive_weights.cpp"
+}
+
+/*
+ * Problem: "The 10 closest facilities" or "everything within distance R" from a source, where Solution::dijkstra
+ * settles (and allocates distTo for) the whole graph before returning anything.
+ *
+ * Approach (resumable Dijkstra generator):
+ * 1. **Settled order on demand**:
+ *    - `LazyDijkstra` holds the search state (distance labels, settled flags, heap) in a caller-owned
+ *      QueryWorkspace (Workspace/query_workspace.h), so starting a search is O(1) and nothing is O(V).
+ *    - `next(out)` pops the heap until it finds an unsettled node, settles it, relaxes its edges and returns
+ *      {node, distance}. Nodes come out in non-decreasing distance, exactly Dijkstra's settle order.
+ *    - The search can be stopped at any point and resumed later with more `next` calls; `peek()` is the
+ *      distance of the node that would be settled next (a lower bound for everything not yet returned).
+ *
+ * 2. **Range interface**:
+ *    - `for (auto [v, d] : search)` iterates the remaining settled order lazily (an input iterator calling
+ *      `next`), so a `break` leaves the rest of the graph untouched.
+ *
+ * 3. **Bounded queries** (built on `next` / `peek`):
+ *    - `nearest(k)`            : the next k settled nodes.
+ *    - `withinRadius(R)`       : every node with distance <= R; stops when peek() > R.
+ *    - `nearestWhere(k, pred)` : the k closest nodes satisfying pred (e.g. "is a facility"), optionally
+ *                                limited to a radius.
+ *
+ * 4. **Multi-source**: `start(sources)` seeds several nodes at distance 0 (nearest facility to any of a set).
+ *
+ * Output contract: distances use `Traits` like Solution::dijkstra (saturating add); `ws.dist.get(v)` keeps the final
+ * distance of every returned node until the workspace is reused.
+ *
+ * Time Complexity:
+ * - **O((V' + E') log V')** for V' settled nodes and their E' edges: proportional to the explored ball, not V.
+ *
+ * Space Complexity:
+ * - The workspace's arrays (grown once to V) plus a heap of at most E' entries; nothing is allocated per query
+ *   once the workspace is warm.
+ *
+ * Graph is `vector<vector<Weight>> adj[]` or any type whose adj[u] iterates {v, w} items; weights must be
+ * non-negative (same restriction as dijkstra). Pointers and trivially copyable views (CsrRows,
+ * GridGraph::WeightedView) are copied into the search, so a temporary view is fine as long as the arrays or grid
+ * behind it outlive the search; any other graph type is held by reference and must outlive it.
+ */
+
+template <class Graph, class Weight = int, class Traits = WeightTraits<Weight>>
+class LazyDijkstra {
+public:
+    using Entry = pair<int, Weight>;  // {node, distance}
+
+    LazyDijkstra(int V, const Graph& adj, QueryWorkspace<Weight>& ws) : n(V), graph(adj), work(ws) {}
+
+    void start(int source) { start(vector<int>{source}); }
+
+    void start(const vector<int>& sources) {
+        work.begin(n, Traits::infinity());
+        for (int s : sources) {
+            if (work.dist.get(s) == 0) continue;
+            work.dist.set(s, 0);
+            work.heap.push_back({0, s});
+        }
+        make_heap(work.heap.begin(), work.heap.end(), cmp);
+    }
+
+    // Settles the next node; false once everything reachable has been returned.
+    bool next(Entry& out) {
+        if (!dropStale()) return false;
+        pop_heap(work.heap.begin(), work.heap.end(), cmp);
+        auto [dis, node] = work.heap.back();
+        work.heap.pop_back();
+        work.state.set(node, 1);
+        work.order.push_back(node);
+        for (auto& it : graph[node]) {
+            int v = it[0];
+            Weight nd = Traits::add(dis, it[1]);
+            if (nd < work.dist.get(v)) {
+                work.dist.set(v, nd);
+                work.heap.push_back({nd, v});
+                push_heap(work.heap.begin(), work.heap.end(), cmp);
+            }
+        }
+        out = {node, dis};
+        return true;
+    }
+
+    // Distance of the node the next call to `next` would return (infinity when exhausted).
+    Weight peek() {
+        return dropStale() ? work.heap.front().first : Traits::infinity();
+    }
+
+    int settled() const { return work.order.size(); }
+
+    vector<Entry> nearest(int k) {
+        return nearestWhere(k, [](int) { return true; });
+    }
+
+    vector<Entry> withinRadius(Weight radius) {
+        vector<Entry> out;
+        Entry e;
+        while (peek() <= radius && next(e)) out.push_back(e);
+        return out;
+    }
+
+    // The k closest (remaining) nodes with pred(node), none farther than `radius`.
+    template <class Pred>
+    vector<Entry> nearestWhere(int k, Pred&& pred, Weight radius = Traits::infinity()) {
+        vector<Entry> out;
+        Entry e;
+        while ((int)out.size() < k && peek() <= radius && next(e))
+            if (pred(e.first)) out.push_back(e);
+        return out;
+    }
+
+    // Input iterator over the remaining settled order.
+    class iterator {
+    public:
+        using value_type = Entry;
+        using difference_type = ptrdiff_t;
+        using pointer = const Entry*;
+        using reference = const Entry&;
+        using iterator_category = input_iterator_tag;
+
+        iterator() = default;
+        explicit iterator(LazyDijkstra* s) : search(s) { ++*this; }
+        const Entry& operator*() const { return current; }
+        iterator& operator++() {
+            if (!search->next(current)) search = nullptr;
+            return *this;
+        }
+        bool operator==(const iterator& o) const { return search == o.search; }
+        bool operator!=(const iterator& o) const { return search != o.search; }
+
+    private:
+        LazyDijkstra* search = nullptr;
+        Entry current;
+    };
+
+    iterator begin() { return iterator(this); }
+    iterator end() { return iterator(); }
+
+private:
+    // Discards heap entries of already settled nodes; false when the heap runs empty.
+    bool dropStale() {
+        while (!work.heap.empty() && work.state.get(work.heap.front().second)) {
+            pop_heap(work.heap.begin(), work.heap.end(), cmp);
+            work.heap.pop_back();
+        }
+        return !work.heap.empty();
+    }
+
+    int n;
+    // Pointers and views (a pointer or two) by value, containers by reference
+    conditional_t<is_trivially_copyable<Graph>::value, Graph, const Graph&> graph;
+    QueryWorkspace<Weight>& work;
+    greater<pair<Weight, int>> cmp;
+};
+
+int main() {
+    // Random directed graph; the lazy settle order must reproduce the full dijkstra distances.
+    int V = 200000;
+    mt19937 rng(48);
+    vector<vector<vector<int>>> adj(V);
+    for (int u = 0; u < V; u++)
+        for (int k = 0; k < 4; k++) adj[u].push_back({(int)(rng() % V), (int)(rng() % 100) + 1});
+    vector<char> facility(V);
+    for (auto& f : facility) f = rng() % 100 == 0;
+
+    QueryWorkspace<int> ws;
+    LazyDijkstra search(V, adj.data(), ws);
+    int mismatches = 0;
+    for (int q = 0; q < 8; q++) {
+        int s = rng() % V;
+        vector<int> full = dijkstra_impl::Solution().dijkstra(V, adj.data(), s);
+        vector<int> sorted = full;
+        sort(sorted.begin(), sorted.end());
+
+        // Whole settle order: non-decreasing and equal to the full distances
+        search.start(s);
+        int last = 0, count = 0;
+        for (auto [v, d] : search) {
+            if (d < last || d != full[v]) mismatches++;
+            last = d;
+            count++;
+        }
+        if (count != V - (int)std::count(full.begin(), full.end(), INT_MAX)) mismatches++;
+
+        // nearest(10) then nearest(10) again (resumed) = the 20 smallest distances
+        search.start(s);
+        auto first = search.nearest(10), second = search.nearest(10);
+        first.insert(first.end(), second.begin(), second.end());
+        for (int i = 0; i < 20; i++)
+            if (first[i].second != sorted[i]) mismatches++;
+
+        // Radius: exactly the nodes with distance <= R
+        int R = sorted[1000];
+        search.start(s);
+        auto ball = search.withinRadius(R);
+        if ((long long)ball.size() != upper_bound(sorted.begin(), sorted.end(), R) - sorted.begin()) mismatches++;
+
+        // k nearest facilities
+        search.start(s);
+        auto found = search.nearestWhere(5, [&](int v) { return facility[v]; });
+        vector<int> expected;
+        for (int v = 0; v < V; v++)
+            if (facility[v] && full[v] != INT_MAX) expected.push_back(full[v]);
+        sort(expected.begin(), expected.end());
+        for (size_t i = 0; i < found.size(); i++)
+            if (found[i].second != expected[i]) mismatches++;
+    }
+    // A temporary view (CsrRows over flat arrays) is copied into the search, not referenced
+    vector<long long> offset(V + 1, 0);
+    vector<array<int, 2>> arcs;
+    for (int u = 0; u < V; u++) {
+        for (auto& it : adj[u]) arcs.push_back({it[0], it[1]});
+        offset[u + 1] = arcs.size();
+    }
+    LazyDijkstra viewSearch(V, CsrRows<array<int, 2>>(offset.data(), arcs.data(), V), ws);
+    for (int q = 0; q < 4; q++) {
+        int s = rng() % V;
+        vector<int> full = dijkstra_impl::Solution().dijkstra(V, adj.data(), s);
+        sort(full.begin(), full.end());
+        viewSearch.start(s);
+        auto first = viewSearch.nearest(50);
+        for (size_t i = 0; i < first.size(); i++)
+            if (first[i].second != full[i]) mismatches++;
+    }
+    cout << "Mismatches: " << mismatches << endl;
+
+    // Cost of "10 nearest facilities" against a full dijkstra per query
+    int queries = 2000;
+    auto t0 = chrono::steady_clock::now();
+    long long settled = 0;
+    for (int q = 0; q < queries; q++) {
+        search.start(rng() % V);
+        search.nearestWhere(10, [&](int v) { return facility[v]; });
+        settled += search.settled();
+    }
+    double lazy = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+    t0 = chrono::steady_clock::now();
+    for (int q = 0; q < 5; q++) dijkstra_impl::Solution().dijkstra(V, adj.data(), (int)(rng() % V));
+    double full = chrono::duration<double>(chrono::steady_clock::now() - t0).count() / 5;
+    cout << "10 nearest facilities: " << lazy / queries * 1e6 << " us/query (" << settled / queries
+         << " nodes settled), full dijkstra: " << full * 1e6 << " us/query" << endl;
+    return 0;
+}
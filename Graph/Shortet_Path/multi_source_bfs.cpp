@@ -0,0 +1,214 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*
+ * Problem: Compute unit-weight (hop) distances from many sources over the same undirected graph, e.g. for
+ * closeness centrality or hop-distance features, without running Solution::shortestPath once per source.
+ *
+ * Approach (Multi-Source BFS, bit-parallel):
+ * 1. **Graph Representation**:
+ *    - The edge list (same `edges, N` input as shortestPath) is turned into a CSR adjacency once, in the
+ *      constructor, and reused by every batch.
+ *
+ * 2. **Batches of 64 * Words sources**:
+ *    - Every node carries three bitsets of `64 * Words` bits (one bit per source in the batch):
+ *      `seen[v]` (sources that already reached v), `frontier[v]` (sources that reached v in the last level)
+ *      and `next[v]` (sources reaching v in the level being built).
+ *    - `Words = 1` processes 64 sources per traversal, `Words = 4` processes 256.
+ *
+ * 3. **Level step**:
+ *    - For every node v with a non-empty frontier and every neighbour u: `next[u] |= frontier[v]`.
+ *    - For every touched u: `next[u] &= ~seen[u]`; the remaining bits are the sources discovering u at this
+ *      level, so `seen[u] |= next[u]`, `frontier[u] = next[u]` and their distance to u is the level.
+ *    - One scan of an adjacency list serves all sources whose BFS is at that node at the same level, which is
+ *      where the speedup over independent BFS runs comes from (adjacency is read ~64x less often).
+ *    - The bitset loops are fixed-length loops over `Words` 64-bit words, so the compiler turns the
+ *      OR / ANDNOT into SIMD instructions (e.g. one AVX2 operation per bitset for Words = 4 with -march=native).
+ *
+ * 4. **Only active nodes are processed**:
+ *    - The nodes with a non-empty frontier and the nodes touched in a level are kept in lists, so a level
+ *      costs O(active nodes + their edges) instead of O(N) (matters for long-diameter graphs such as grids).
+ *
+ * 5. **Output**:
+ *    - `distances(sources)` returns the full matrix, row i = the shortestPath(..., sources[i]) result
+ *      (-1 for unreachable nodes).
+ *    - `forEachSource(sources, callback)` streams one row at a time and only keeps one batch of rows alive,
+ *      for source sets whose full matrix would not fit in memory.
+ *
+ * Time Complexity:
+ * - **O(ceil(S / (64 * Words)) * (N + M) * Words)** word operations for S sources, versus O(S * (N + M))
+ *   for S independent BFS runs; writing the distance rows adds O(S * N).
+ *
+ * Space Complexity:
+ * - **O(N + M)** for the CSR, **O(N * Words)** words for the three bitsets and **O(64 * Words * N)** for the
+ *   distance rows of one batch.
+ */
+
+template <int Words>
+class MultiSourceBFS {
+public:
+    static constexpr int kBatch = 64 * Words;  // Sources processed by one traversal
+
+    MultiSourceBFS(vector<vector<int>>& edges, int N) : n(N) {
+        // Step 1: Build the undirected CSR adjacency once
+        start.assign(n + 1, 0);
+        for (auto& it : edges) {
+            start[it[0] + 1]++;
+            start[it[1] + 1]++;
+        }
+        for (int i = 0; i < n; i++) start[i + 1] += start[i];
+        to.resize(start[n]);
+        vector<int> pos(start.begin(), start.end() - 1);
+        for (auto& it : edges) {
+            to[pos[it[0]]++] = it[1];
+            to[pos[it[1]]++] = it[0];
+        }
+
+        seen.resize(n);
+        frontier.resize(n);
+        next.resize(n);
+        touched.assign(n, 0);
+    }
+
+    // Row i holds the hop distance from sources[i] to every node, -1 when unreachable.
+    vector<vector<int>> distances(const vector<int>& sources) {
+        vector<vector<int>> ans(sources.size());
+        forEachSource(sources, [&](int i, const vector<int>& dist) { ans[i] = dist; });
+        return ans;
+    }
+
+    // Calls onSource(i, dist) once per source (dist = distances from sources[i]), batch by batch.
+    void forEachSource(const vector<int>& sources, const function<void(int, const vector<int>&)>& onSource) {
+        vector<vector<int>> rows(min<size_t>(kBatch, sources.size()), vector<int>(n));
+        for (size_t first = 0; first < sources.size(); first += kBatch) {
+            int count = min<size_t>(kBatch, sources.size() - first);
+            runBatch(&sources[first], count, rows);
+            for (int b = 0; b < count; b++) onSource(first + b, rows[b]);
+        }
+    }
+
+private:
+    using Mask = array<uint64_t, Words>;
+
+    static bool any(const Mask& m) {
+        uint64_t acc = 0;
+        for (int w = 0; w < Words; w++) acc |= m[w];
+        return acc != 0;
+    }
+
+    // Runs one bit-parallel BFS for `count` <= kBatch sources and fills rows[0..count).
+    void runBatch(const int* src, int count, vector<vector<int>>& rows) {
+        for (int b = 0; b < count; b++) fill(rows[b].begin(), rows[b].end(), -1);
+        for (int v = 0; v < n; v++) {
+            seen[v].fill(0);
+            frontier[v].fill(0);
+            next[v].fill(0);
+        }
+
+        // Step 2: Every source starts in its own bit
+        vector<int> active, reached;
+        for (int b = 0; b < count; b++) {
+            int s = src[b];
+            if (!any(frontier[s])) active.push_back(s);
+            seen[s][b / 64] |= 1ULL << (b % 64);
+            frontier[s][b / 64] |= 1ULL << (b % 64);
+            rows[b][s] = 0;
+        }
+
+        // Step 3: Expand all BFS frontiers one level at a time
+        for (int level = 1; !active.empty(); level++) {
+            reached.clear();
+            for (int v : active) {
+                const Mask& f = frontier[v];
+                for (int e = start[v]; e < start[v + 1]; e++) {
+                    int u = to[e];
+                    if (!touched[u]) {
+                        touched[u] = 1;
+                        reached.push_back(u);
+                    }
+                    Mask& nx = next[u];
+                    for (int w = 0; w < Words; w++) nx[w] |= f[w];
+                }
+            }
+            for (int v : active) frontier[v].fill(0);
+
+            // Step 4: Keep only the sources that see each touched node for the first time
+            active.clear();
+            for (int u : reached) {
+                touched[u] = 0;
+                Mask fresh;
+                for (int w = 0; w < Words; w++) {
+                    fresh[w] = next[u][w] & ~seen[u][w];
+                    seen[u][w] |= fresh[w];
+                    next[u][w] = 0;
+                }
+                if (!any(fresh)) continue;
+                frontier[u] = fresh;
+                active.push_back(u);
+                for (int w = 0; w < Words; w++) {
+                    for (uint64_t bits = fresh[w]; bits; bits &= bits - 1) {
+                        rows[w * 64 + __builtin_ctzll(bits)][u] = level;
+                    }
+                }
+            }
+        }
+    }
+
+    int n;
+    vector<int> start, to;               // CSR adjacency
+    vector<Mask> seen, frontier, next;   // One bit per source of the current batch
+    vector<char> touched;                // u is already in this level's `reached` list
+};
+
+// Plain BFS with the shortestPath contract, used as the reference in main.
+vector<int> referenceBFS(vector<vector<int>>& edges, int N, int src) {
+    vector<vector<int>> adj(N);
+    for (auto& it : edges) {
+        adj[it[0]].push_back(it[1]);
+        adj[it[1]].push_back(it[0]);
+    }
+    vector<int> dist(N, -1);
+    queue<int> q;
+    dist[src] = 0;
+    q.push(src);
+    while (!q.empty()) {
+        int node = q.front();
+        q.pop();
+        for (int it : adj[node]) {
+            if (dist[it] == -1) {
+                dist[it] = dist[node] + 1;
+                q.push(it);
+            }
+        }
+    }
+    return dist;
+}
+
+int main() {
+    // Sparse random graph with a few disconnected nodes; 300 sources exercise a partial last batch.
+    int N = 20000, M = 60000;
+    mt19937 rng(11);
+    vector<vector<int>> edges;
+    for (int i = 0; i < M; i++) edges.push_back({(int)(rng() % (N - 50)), (int)(rng() % (N - 50))});
+    vector<int> sources;
+    for (int i = 0; i < 300; i++) sources.push_back(rng() % N);
+
+    auto time = [](auto&& fn) {
+        auto t0 = chrono::steady_clock::now();
+        fn();
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+    };
+
+    vector<vector<int>> expected(sources.size()), got64, got256;
+    double tRef = time([&] {
+        for (size_t i = 0; i < sources.size(); i++) expected[i] = referenceBFS(edges, N, sources[i]);
+    });
+    MultiSourceBFS<1> bfs64(edges, N);
+    MultiSourceBFS<4> bfs256(edges, N);
+    double t64 = time([&] { got64 = bfs64.distances(sources); });
+    double t256 = time([&] { got256 = bfs256.distances(sources); });
+
+    cout << "Independent BFS: " << tRef << " ms, MS-BFS 64: " << t64 << " ms, MS-BFS 256: " << t256 << " ms" << endl;
+    cout << "Results match: " << (got64 == expected && got256 == expected ? "yes" : "no") << endl;
+    return 0;
+}
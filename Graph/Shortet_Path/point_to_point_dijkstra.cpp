@@ -0,0 +1,359 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+#include "../Instrumentation/graph_counters.h"
+#include "../Weights/weight_traits.h"
+#include "../Workspace/query_workspace.h"
+namespace dijkstra_impl {
+#include "dijkstras_positive_weights.cpp"
+}
+
+/*
+ * Problem: Answer many single source -> target shortest path queries on the same weighted directed graph,
+ * returning the distance and the path, without settling the whole graph like Solution::dijkstra does.
+ *
+ * Approach:
+ * 1. **Preprocessing (once per graph)**:
+ *    - The `vector<vector<int>> adj[]` input (adj[u] = {{v, w}, ...}, the dijkstra format) is flattened into a
+ *      forward CSR and a reverse CSR (every edge u -> v stored as v <- u) so both search directions scan
+ *      contiguous memory.
+ *
+ * 2. **Early termination** (`query`):
+ *    - Plain dijkstra that stops as soon as the target is popped from the priority queue.
+ *
+ * 3. **Bidirectional Dijkstra** (`bidirectionalQuery`):
+ *    - A forward search from the source on the graph and a backward search from the target on the reverse CSR,
+ *      always advancing the side with the smaller queue top.
+ *    - Every time an edge reaches a node already labelled by the other side, `mu = min(mu, df[u] + w + db[v])`.
+ *    - Stop when topForward + topBackward >= mu: no undiscovered path can be shorter than mu.
+ *
+ * 4. **A*** (`aStarQuery` / `altQuery`):
+ *    - Nodes are ordered by `dist + h(node)`, where h is a lower bound on the remaining distance to the target.
+ *    - `aStarQuery` takes a caller-supplied consistent heuristic (e.g. straight-line distance on road networks).
+ *    - `altQuery` uses ALT (A*, Landmarks, Triangle inequality): `buildLandmarks(k)` picks k far-apart landmarks
+ *      and stores d(L, v) and d(v, L); then h(v) = max_L max(d(L, t) - d(L, v), d(v, L) - d(t, L)).
+ *
+ * 5. **Reusable scratch**:
+ *    - Distance / parent arrays are stamped with a query id, so starting a query is O(1) instead of O(V).
+ *
+ * Output contract (same as Solution::dijkstra): distances are ints, an unreachable target has distance INT_MAX
+ * and an empty path. `settled` reports how many nodes were popped and expanded.
+ *
+ * Time Complexity:
+ * - Every query is O(E' log V') where V', E' are the nodes and edges explored; in the worst case O(E log V).
+ * - Bidirectional search explores roughly two balls of radius d/2 instead of one of radius d, and ALT shrinks
+ *   the explored region further towards the target.
+ * - `buildLandmarks(k)` costs 2k full Dijkstra runs.
+ *
+ * Space Complexity:
+ * - **O(V + E)** for the two CSR arrays and the scratch arrays, plus **O(k * V)** for the landmark tables.
+ *
+ * Negative weights are not supported (same restriction as dijkstra).
+ */
+
+class PointToPointDijkstra {
+public:
+    struct Result {
+        int distance = INT_MAX;  // INT_MAX when the target is unreachable
+        vector<int> path;        // source ... target, empty when unreachable
+        int settled = 0;         // nodes expanded by the search(es)
+    };
+
+    PointToPointDijkstra(int V, vector<vector<int>> adj[]) : n(V) {
+        // Step 1: Build forward and reverse CSR from the adjacency list
+        fwdStart.assign(n + 1, 0);
+        bwdStart.assign(n + 1, 0);
+        for (int u = 0; u < n; u++) {
+            for (auto& it : adj[u]) {
+                fwdStart[u + 1]++;
+                bwdStart[it[0] + 1]++;
+            }
+        }
+        for (int i = 0; i < n; i++) {
+            fwdStart[i + 1] += fwdStart[i];
+            bwdStart[i + 1] += bwdStart[i];
+        }
+        fwdTo.resize(fwdStart[n]);
+        fwdWt.resize(fwdStart[n]);
+        bwdTo.resize(bwdStart[n]);
+        bwdWt.resize(bwdStart[n]);
+        vector<int> fpos(fwdStart.begin(), fwdStart.end() - 1), bpos(bwdStart.begin(), bwdStart.end() - 1);
+        for (int u = 0; u < n; u++) {
+            for (auto& it : adj[u]) {
+                int v = it[0], w = it[1];
+                fwdTo[fpos[u]] = v;
+                fwdWt[fpos[u]++] = w;
+                bwdTo[bpos[v]] = u;
+                bwdWt[bpos[v]++] = w;
+            }
+        }
+        side[0].init(n);
+        side[1].init(n);
+    }
+
+    // Unidirectional Dijkstra that stops when the target is settled.
+    Result query(int s, int t) {
+        return aStarQuery(s, t, [](int) { return 0; });
+    }
+
+    // A* with a caller-supplied heuristic h(v) <= dist(v, t); h must be consistent (h(u) <= w(u,v) + h(v)).
+    Result aStarQuery(int s, int t, const function<int(int)>& h) {
+        Result res;
+        Scratch& f = side[0];
+        f.reset();
+        f.set(s, 0, -1);
+        PQ pq;
+        pq.push({(long long)h(s), s});
+
+        while (!pq.empty()) {
+            auto [key, node] = pq.top();
+            pq.pop();
+            if (f.done(node)) continue;  // Stale entry
+            f.settle(node);
+            res.settled++;
+            if (node == t) break;
+
+            long long d = f.dist[node];
+            for (int e = fwdStart[node]; e < fwdStart[node + 1]; e++) {
+                int v = fwdTo[e];
+                long long nd = d + fwdWt[e];
+                if (nd < f.get(v)) {
+                    f.set(v, nd, node);
+                    pq.push({nd + h(v), v});
+                }
+            }
+        }
+        if (f.get(t) != INF) finishPath(res, t, false);
+        return res;
+    }
+
+    // Bidirectional Dijkstra: forward search on the graph, backward search on the reverse CSR.
+    Result bidirectionalQuery(int s, int t) {
+        Result res;
+        Scratch& f = side[0];
+        Scratch& b = side[1];
+        f.reset();
+        b.reset();
+        f.set(s, 0, -1);
+        b.set(t, 0, -1);
+        PQ pq[2];
+        pq[0].push({0, s});
+        pq[1].push({0, t});
+
+        long long mu = s == t ? 0 : INF;  // Best s-t path length seen so far
+        int meet = s == t ? s : -1;
+
+        while (!pq[0].empty() && !pq[1].empty()) {
+            // Stopping rule: no undiscovered path can beat mu
+            if (pq[0].top().first + pq[1].top().first >= mu) break;
+
+            int dir = pq[0].top().first <= pq[1].top().first ? 0 : 1;
+            auto [d, node] = pq[dir].top();
+            pq[dir].pop();
+            Scratch& me = side[dir];
+            Scratch& other = side[dir ^ 1];
+            if (me.done(node)) continue;
+            me.settle(node);
+            res.settled++;
+
+            const vector<int>& start = dir == 0 ? fwdStart : bwdStart;
+            const vector<int>& to = dir == 0 ? fwdTo : bwdTo;
+            const vector<int>& wt = dir == 0 ? fwdWt : bwdWt;
+            for (int e = start[node]; e < start[node + 1]; e++) {
+                int v = to[e];
+                long long nd = d + wt[e];
+                if (nd < me.get(v)) {
+                    me.set(v, nd, node);
+                    pq[dir].push({nd, v});
+                }
+                // Connection through edge (node, v): forward label + edge + backward label
+                long long ov = other.get(v);
+                if (ov != INF && me.get(v) + ov < mu) {
+                    mu = me.get(v) + ov;
+                    meet = v;
+                }
+            }
+        }
+
+        if (meet != -1) finishPath(res, meet, true);
+        return res;
+    }
+
+    // Selects k landmarks by farthest-point sampling and stores forward / backward distances to all nodes.
+    void buildLandmarks(int k, int seed = 0) {
+        landmarks.clear();
+        fromLandmark.clear();
+        toLandmark.clear();
+        k = min(k, n);
+        if (k == 0) return;
+
+        // Minimum (symmetrised) distance from the chosen landmarks; the next landmark maximises it.
+        vector<long long> closest(n, INF);
+        int next = seed % n;
+        for (int i = 0; i < k; i++) {
+            landmarks.push_back(next);
+            fromLandmark.push_back(fullDijkstra(next, fwdStart, fwdTo, fwdWt));
+            toLandmark.push_back(fullDijkstra(next, bwdStart, bwdTo, bwdWt));
+
+            int best = -1;
+            long long bestDist = -1;
+            for (int v = 0; v < n; v++) {
+                long long d = min<long long>(fromLandmark.back()[v], toLandmark.back()[v]);
+                closest[v] = min(closest[v], d);
+                // Unreachable nodes (closest == INF) are skipped: a landmark there would bound nothing
+                if (closest[v] != INF && closest[v] > bestDist) {
+                    bestDist = closest[v];
+                    best = v;
+                }
+            }
+            if (best == -1 || bestDist == 0) break;
+            next = best;
+        }
+    }
+
+    // A* with ALT lower bounds from the landmarks built by buildLandmarks (plain early-exit Dijkstra without them).
+    Result altQuery(int s, int t) {
+        return aStarQuery(s, t, [&](int v) { return altBound(v, t); });
+    }
+
+    int landmarkCount() const { return landmarks.size(); }
+
+private:
+    static constexpr long long INF = LLONG_MAX / 4;
+    using PQ = priority_queue<pair<long long, int>, vector<pair<long long, int>>, greater<pair<long long, int>>>;
+
+    // Per-direction search labels; a label is valid only if its stamp equals the current query id.
+    struct Scratch {
+        vector<long long> dist;
+        vector<int> parent;
+        vector<unsigned> stamp, doneStamp;
+        unsigned query = 0;
+
+        void init(int n) {
+            dist.assign(n, INF);
+            parent.assign(n, -1);
+            stamp.assign(n, 0);
+            doneStamp.assign(n, 0);
+        }
+        void reset() {
+            if (++query == 0) {  // Stamp wrapped around: clear once every 2^32 queries
+                fill(stamp.begin(), stamp.end(), 0);
+                fill(doneStamp.begin(), doneStamp.end(), 0);
+                query = 1;
+            }
+        }
+        long long get(int v) const { return stamp[v] == query ? dist[v] : INF; }
+        void set(int v, long long d, int p) {
+            stamp[v] = query;
+            dist[v] = d;
+            parent[v] = p;
+        }
+        bool done(int v) const { return doneStamp[v] == query; }
+        void settle(int v) { doneStamp[v] = query; }
+    };
+
+    int altBound(int v, int t) const {
+        long long best = 0;
+        for (size_t i = 0; i < landmarks.size(); i++) {
+            // d(L, t) <= d(L, v) + d(v, t)
+            int lv = fromLandmark[i][v], lt = fromLandmark[i][t];
+            if (lv != INT_MAX && lt != INT_MAX) best = max<long long>(best, (long long)lt - lv);
+            // d(v, L) <= d(v, t) + d(t, L)
+            int vl = toLandmark[i][v], tl = toLandmark[i][t];
+            if (vl != INT_MAX && tl != INT_MAX) best = max<long long>(best, (long long)vl - tl);
+        }
+        return (int)min<long long>(best, INT_MAX - 1);
+    }
+
+    vector<int> fullDijkstra(int src, const vector<int>& start, const vector<int>& to, const vector<int>& wt) const {
+        vector<int> dist(n, INT_MAX);
+        PQ pq;
+        dist[src] = 0;
+        pq.push({0, src});
+        while (!pq.empty()) {
+            auto [d, node] = pq.top();
+            pq.pop();
+            if (d > dist[node]) continue;
+            for (int e = start[node]; e < start[node + 1]; e++) {
+                long long nd = d + wt[e];
+                if (nd < dist[to[e]]) {
+                    dist[to[e]] = nd;
+                    pq.push({nd, to[e]});
+                }
+            }
+        }
+        return dist;
+    }
+
+    // Builds s -> meet from the forward parents and, for bidirectional searches, meet -> t from the backward parents.
+    void finishPath(Result& res, int meet, bool withBackward) {
+        long long total = side[0].get(meet) + (withBackward ? side[1].get(meet) : 0);
+        res.distance = (int)min<long long>(total, INT_MAX);
+
+        for (int v = meet; v != -1; v = side[0].parent[v]) res.path.push_back(v);
+        reverse(res.path.begin(), res.path.end());
+        if (withBackward) {
+            for (int v = side[1].parent[meet]; v != -1; v = side[1].parent[v]) res.path.push_back(v);
+        }
+    }
+
+    int n;
+    vector<int> fwdStart, fwdTo, fwdWt, bwdStart, bwdTo, bwdWt;
+    Scratch side[2];
+    vector<int> landmarks;
+    vector<vector<int>> fromLandmark, toLandmark;
+};
+
+int main() {
+    // Random sparse directed graph; every point-to-point mode must agree with an independent full
+    // Solution::dijkstra run from s.
+    int V = 2000;
+    mt19937 rng(7);
+    vector<vector<int>> adj[V];
+    for (int u = 0; u < V; u++) {
+        for (int k = 0; k < 4; k++) {
+            int v = rng() % V;
+            if (v != u) adj[u].push_back({v, (int)(rng() % 100) + 1});
+        }
+    }
+
+    PointToPointDijkstra engine(V, adj);
+    engine.buildLandmarks(8);
+
+    long long settled[4] = {0, 0, 0, 0};
+    int queries = 200, mismatches = 0;
+    for (int q = 0; q < queries; q++) {
+        int s = rng() % V, t = rng() % V;
+        int expected = dijkstra_impl::Solution().dijkstra(V, adj, s)[t];
+        PointToPointDijkstra::Result r[4] = {
+            engine.query(s, t),
+            engine.bidirectionalQuery(s, t),
+            engine.aStarQuery(s, t, [](int) { return 0; }),
+            engine.altQuery(s, t),
+        };
+        for (int i = 0; i < 4; i++) {
+            settled[i] += r[i].settled;
+            // The path must start at s, end at t and have exactly the reported length
+            long long len = 0;
+            bool ok = r[i].distance == expected;
+            if (r[i].distance != INT_MAX) {
+                ok = ok && r[i].path.front() == s && r[i].path.back() == t;
+                for (size_t j = 0; ok && j + 1 < r[i].path.size(); j++) {
+                    long long w = LLONG_MAX;
+                    for (auto& it : adj[r[i].path[j]])
+                        if (it[0] == r[i].path[j + 1]) w = min<long long>(w, it[1]);
+                    ok = w != LLONG_MAX;
+                    len += w;
+                }
+                ok = ok && len == r[i].distance;
+            }
+            if (!ok) mismatches++;
+        }
+    }
+
+    cout << "Mismatches: " << mismatches << endl;
+    cout << "Average settled nodes (early exit / bidirectional / A* h=0 / ALT): "
+         << settled[0] / queries << " / " << settled[1] / queries << " / "
+         << settled[2] / queries << " / " << settled[3] / queries << endl;
+    return 0;
+}
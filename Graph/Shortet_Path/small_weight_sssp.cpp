@@ -0,0 +1,151 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+#include "../Instrumentation/graph_counters.h"
+#include "../Weights/weight_traits.h"
+#include "../Workspace/query_workspace.h"
+namespace dijkstra_impl {
+#include "dijkstras_positive_weights.cpp"
+}
+
+/*
+ * Problem: Single-source shortest paths when the edge weights are small non-negative integers (0..255, or just {0, 1}),
+ * where dijkstra's O(log V) priority queue operations are unnecessary.
+ *
+ * Approach:
+ * 1. **0-1 BFS** (`zeroOneBfs`, all weights in {0, 1}):
+ *    - A deque replaces the priority queue: a 0-edge pushes the neighbour to the front (same distance), a 1-edge
+ *      pushes it to the back (distance + 1). The deque always holds at most two consecutive distances in order, so
+ *      nodes are popped in non-decreasing distance like in Dijkstra.
+ *
+ * 2. **Dial's algorithm** (`dial`, weights in 0..C):
+ *    - A circular array of C + 1 buckets, bucket `d % (C + 1)` holding the nodes tentatively at distance d.
+ *    - Every queued distance lies in [current, current + C], so C + 1 buckets never collide.
+ *    - Scan buckets in order; a node whose stored distance no longer matches its bucket is a stale entry (lazy
+ *      deletion, same idea as dijkstra's `dis > distTo[node]` check). A 0-edge appends to the bucket being scanned.
+ *
+ * 3. **Engine selection** (`shortestPath`):
+ *    - One pass over the edges finds the weight range: {0, 1} -> 0-1 BFS, 0..kMaxDialWeight -> Dial,
+ *      otherwise (large or negative weights) fall back to Solution::dijkstra.
+ *
+ * Output contract (same as Solution::dijkstra): distTo[v] is the shortest distance, INT_MAX when unreachable.
+ * Dial's distances reach (V - 1) * C, past INT_MAX for V > ~524k at C = 4096, so they are formed in long long and
+ * a sum of INT_MAX or more saturates to INT_MAX, like dijkstra's saturating add.
+ *
+ * Time Complexity:
+ * - 0-1 BFS: **O(V + E)**.
+ * - Dial: **O(V + E + D)** where D <= (V - 1) * C is the largest finite distance (empty buckets are skipped one by one).
+ *
+ * Space Complexity:
+ * - **O(V + E)**; Dial adds C + 1 bucket vectors.
+ */
+
+class SmallWeightSssp {
+public:
+    static constexpr int kMaxDialWeight = 1 << 12;  // Above this the bucket scan stops paying off
+
+    // Picks the engine from the weight range of adj.
+    vector<int> shortestPath(int V, vector<vector<int>> adj[], int S) {
+        int lo = INT_MAX, hi = 0;
+        for (int u = 0; u < V; u++) {
+            for (auto& it : adj[u]) {
+                lo = min(lo, it[1]);
+                hi = max(hi, it[1]);
+            }
+        }
+        if (lo < 0 || hi > kMaxDialWeight) return dijkstra_impl::Solution().dijkstra(V, adj, S);
+        if (hi <= 1) return zeroOneBfs(V, adj, S);
+        return dial(V, adj, S, hi);
+    }
+
+    // All weights must be 0 or 1.
+    vector<int> zeroOneBfs(int V, vector<vector<int>> adj[], int S) {
+        vector<int> distTo(V, INT_MAX);
+        deque<int> dq;
+        distTo[S] = 0;
+        dq.push_back(S);
+        while (!dq.empty()) {
+            int node = dq.front();
+            dq.pop_front();
+            for (auto& it : adj[node]) {
+                int v = it[0], w = it[1];
+                if (distTo[node] + w < distTo[v]) {
+                    distTo[v] = distTo[node] + w;
+                    if (w == 0) dq.push_front(v);
+                    else dq.push_back(v);
+                }
+            }
+        }
+        return distTo;
+    }
+
+    // All weights must lie in [0, maxWeight].
+    vector<int> dial(int V, vector<vector<int>> adj[], int S, int maxWeight) {
+        vector<int> distTo(V, INT_MAX);
+        vector<vector<int>> buckets(maxWeight + 1);
+        distTo[S] = 0;
+        buckets[0].push_back(S);
+        long long pending = 1;  // Entries (including stale ones) still sitting in buckets
+
+        for (long long d = 0; pending > 0; d++) {
+            vector<int>& bucket = buckets[d % (maxWeight + 1)];
+            // Index loop: 0-weight edges append to this same bucket while it is scanned
+            for (size_t i = 0; i < bucket.size(); i++) {
+                int node = bucket[i];
+                pending--;
+                if (distTo[node] != d) continue;  // Stale entry, node was improved later
+                for (auto& it : adj[node]) {
+                    int v = it[0];
+                    long long nd = d + it[1];  // Never below INT_MAX once saturated, so never stored
+                    if (nd < distTo[v]) {
+                        distTo[v] = nd;
+                        buckets[nd % (maxWeight + 1)].push_back(v);
+                        pending++;
+                    }
+                }
+            }
+            bucket.clear();
+        }
+        return distTo;
+    }
+};
+
+int main() {
+    // Random graphs with {0, 1} weights and 0..255 weights; every engine must match dijkstra.
+    int V = 50000;
+    mt19937 rng(17);
+    auto build = [&](int maxW, vector<vector<vector<int>>>& adj) {
+        adj.assign(V, {});
+        for (int u = 0; u < V; u++) {
+            for (int k = 0; k < 5; k++) adj[u].push_back({(int)(rng() % V), (int)(rng() % (maxW + 1))});
+        }
+    };
+    auto time = [](auto&& fn) {
+        auto t0 = chrono::steady_clock::now();
+        fn();
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+    };
+
+    SmallWeightSssp engine;
+    for (int maxW : {1, 255}) {
+        vector<vector<vector<int>>> adj;
+        build(maxW, adj);
+        vector<int> expected, got;
+        double tDijkstra = time([&] { expected = dijkstra_impl::Solution().dijkstra(V, adj.data(), 0); });
+        double tEngine = time([&] {
+            got = maxW == 1 ? engine.zeroOneBfs(V, adj.data(), 0) : engine.dial(V, adj.data(), 0, maxW);
+        });
+        bool ok = got == expected && engine.shortestPath(V, adj.data(), 0) == expected;
+        cout << "Weights 0.." << maxW << ": dijkstra " << tDijkstra << " ms, " << (maxW == 1 ? "0-1 BFS " : "Dial ")
+             << tEngine << " ms, match: " << (ok ? "yes" : "no") << endl;
+    }
+
+    // A 600k-node chain of weight-4096 edges: distances pass INT_MAX and must saturate like dijkstra's
+    int chain = 600000;
+    vector<vector<vector<int>>> path(chain);
+    for (int u = 0; u + 1 < chain; u++) path[u].push_back({u + 1, SmallWeightSssp::kMaxDialWeight});
+    vector<int> expected = dijkstra_impl::Solution().dijkstra(chain, path.data(), 0);
+    bool ok = engine.shortestPath(chain, path.data(), 0) == expected;
+    cout << "Long chain: last distance " << expected.back() << ", match: " << (ok ? "yes" : "no") << endl;
+    return 0;
+}
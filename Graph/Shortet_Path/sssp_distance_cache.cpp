@@ -0,0 +1,334 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+#include "../Instrumentation/graph_counters.h"
+#include "../Weights/weight_traits.h"
+#include "../Workspace/query_workspace.h"
+namespace dijkstra_impl {
+#include "dijkstras_positive_weights.cpp"
+}
+
+/*
+ * Problem: A service calls Solution::dijkstra over and over on the same static graph, mostly from a few thousand
+ * hot sources. Recomputing a full single-source run for a repeated source wastes the whole O(E log V).
+ *
+ * Approach (size-bounded LRU cache of SSSP results):
+ * 1. **Keys**:
+ *    - Every entry is keyed by (graph version, source, kind). `setGraph(V, adj, version)` installs a new graph; entries
+ *      of any other version are dropped immediately, so a stale distance can never be served.
+ *    - kind = full distance vector (`distances`) or settled prefix of a bounded query (`withinRadius`).
+ *
+ * 2. **Compressed values**:
+ *    - Full vectors: one LEB128 varint per node, 0 for unreachable and d + 1 otherwise (zigzag-encoded so negative
+ *      Weights also round-trip). Small distances take 1-2 bytes instead of sizeof(Weight).
+ *    - Settled prefixes: the (node, dist) pairs in settle order, i.e. sorted by distance, so distances are stored as
+ *      non-negative deltas and nodes as zigzag deltas from the previous node.
+ *
+ * 3. **Bounded queries**:
+ *    - `withinRadius(source, r)` returns every node with dist <= r, nearest first, using a Dijkstra that stops once the
+ *      queue top exceeds r. A cached prefix of radius R >= r answers the query by truncation.
+ *
+ * 4. **Eviction and statistics**:
+ *    - Entries live in an LRU list; when the encoded bytes exceed `capacityBytes` the least recently used entries are
+ *      evicted. `stats()` reports hits, misses, evictions, invalidations, resident bytes and the hit rate.
+ *
+ * All public methods lock an internal mutex, but misses compute outside the lock so concurrent cold queries do not
+ * serialize (two threads missing the same key may both compute it; the second insert just refreshes the entry).
+ *
+ * Time Complexity:
+ * - Hit: **O(V)** to decode a full vector (or O(k) for a k-node prefix), versus O(E log V) for a new Dijkstra run.
+ * - Miss: the Dijkstra run plus O(V) encoding.
+ *
+ * Space Complexity:
+ * - At most `capacityBytes` of encoded results, plus O(1) bookkeeping per entry.
+ *
+ * Weights must be integral (varint encoding); unreachable nodes are `Traits::infinity()` (INT_MAX for int), exactly
+ * as Solution::dijkstra returns them.
+ */
+
+template <class Weight = int, class Traits = WeightTraits<Weight>>
+class SsspDistanceCache {
+    static_assert(is_integral<Weight>::value, "SsspDistanceCache compresses integral distances");
+
+public:
+    struct Stats {
+        long long hits = 0, misses = 0, evictions = 0, invalidations = 0;
+        size_t entries = 0, bytes = 0;
+        double hitRate() const { return hits + misses ? double(hits) / double(hits + misses) : 0.0; }
+    };
+
+    explicit SsspDistanceCache(size_t capacityBytes) : capacity(capacityBytes) {}
+
+    // Installs the graph answered from now on. A different version invalidates every cached entry.
+    // adj must stay alive and unchanged until the next setGraph call.
+    void setGraph(int V, vector<vector<Weight>> adj[], uint64_t graphVersion) {
+        lock_guard<mutex> guard(lock);
+        n = V;
+        graph = adj;
+        if (graphVersion == version) return;
+        version = graphVersion;
+        counts.invalidations += index.size();
+        lru.clear();
+        index.clear();
+        resident = 0;
+    }
+
+    // Same result as Solution::dijkstra(V, adj, source).
+    vector<Weight> distances(int source) {
+        Key key;
+        Snapshot g;
+        {
+            lock_guard<mutex> guard(lock);
+            key = {version, source, false};
+            g = {n, graph};
+            if (const Entry* e = lookup(key)) return decodeFull(e->bytes);
+            counts.misses++;
+        }
+        vector<Weight> dist = dijkstra_impl::Solution().dijkstra<Weight, Traits>(g.n, g.adj, source);
+        insert({key, 0, encodeFull(dist)});
+        return dist;
+    }
+
+    // Every node with dist(source, node) <= radius as {node, dist}, in non-decreasing distance order.
+    vector<pair<int, Weight>> withinRadius(int source, Weight radius) {
+        Key key;
+        Snapshot g;
+        {
+            lock_guard<mutex> guard(lock);
+            key = {version, source, true};
+            g = {n, graph};
+            if (const Entry* e = lookup(key)) {
+                if (e->radius >= radius) return decodePrefix(e->bytes, radius);
+                // Cached prefix is too short: treat as a miss and replace it with the larger radius.
+                counts.hits--;
+                counts.misses++;
+            } else {
+                counts.misses++;
+            }
+        }
+        vector<pair<int, Weight>> settled = boundedDijkstra(g, source, radius);
+        insert({key, radius, encodePrefix(settled)});
+        return settled;
+    }
+
+    Stats stats() const {
+        lock_guard<mutex> guard(lock);
+        Stats s = counts;
+        s.entries = index.size();
+        s.bytes = resident;
+        return s;
+    }
+
+private:
+    struct Key {
+        uint64_t version;
+        int source;
+        bool prefix;
+        bool operator==(const Key& o) const { return version == o.version && source == o.source && prefix == o.prefix; }
+    };
+    struct KeyHash {
+        size_t operator()(const Key& k) const {
+            return hash<uint64_t>()(k.version * 0x9E3779B97F4A7C15ULL ^ (uint64_t(k.source) << 1 | k.prefix));
+        }
+    };
+    struct Snapshot {  // Graph a query runs on, copied under the lock
+        int n;
+        vector<vector<Weight>>* adj;
+    };
+    struct Entry {
+        Key key;
+        Weight radius;          // Prefix entries: the radius the prefix is complete for
+        vector<uint8_t> bytes;  // Encoded result
+    };
+
+    // Returns the entry and marks it most recently used; counts a hit. Caller holds the lock.
+    const Entry* lookup(const Key& key) {
+        auto it = index.find(key);
+        if (it == index.end()) return nullptr;
+        lru.splice(lru.begin(), lru, it->second);
+        counts.hits++;
+        return &*it->second;
+    }
+
+    void insert(Entry entry) {
+        lock_guard<mutex> guard(lock);
+        if (entry.key.version != version) return;  // Graph changed while computing
+        auto it = index.find(entry.key);
+        if (it != index.end()) {
+            resident -= it->second->bytes.size();
+            lru.erase(it->second);
+            index.erase(it);
+        }
+        if (entry.bytes.size() > capacity) return;  // Would never fit
+        resident += entry.bytes.size();
+        lru.push_front(move(entry));
+        index[lru.front().key] = lru.begin();
+        while (resident > capacity) {
+            resident -= lru.back().bytes.size();
+            index.erase(lru.back().key);
+            lru.pop_back();
+            counts.evictions++;
+        }
+    }
+
+    // Dijkstra that stops as soon as the smallest queued distance exceeds `radius`.
+    static vector<pair<int, Weight>> boundedDijkstra(const Snapshot& g, int source, Weight radius) {
+        vector<Weight> dist(g.n, Traits::infinity());
+        priority_queue<pair<Weight, int>, vector<pair<Weight, int>>, greater<pair<Weight, int>>> pq;
+        vector<pair<int, Weight>> settled;
+        dist[source] = 0;
+        pq.push({0, source});
+        while (!pq.empty() && pq.top().first <= radius) {
+            auto [dis, node] = pq.top();
+            pq.pop();
+            if (dis > dist[node]) continue;  // Stale entry
+            settled.push_back({node, dis});
+            for (auto& it : g.adj[node]) {
+                int v = it[0];
+                Weight nd = Traits::add(dis, it[1]);
+                if (nd < dist[v]) {
+                    dist[v] = nd;
+                    pq.push({nd, v});
+                }
+            }
+        }
+        return settled;
+    }
+
+    using Wide = make_unsigned_t<conditional_t<(sizeof(Weight) > 4), long long, int>>;
+
+    static void putVarint(vector<uint8_t>& out, Wide x) {
+        while (x >= 0x80) {
+            out.push_back(uint8_t(x) | 0x80);
+            x >>= 7;
+        }
+        out.push_back(uint8_t(x));
+    }
+    static Wide getVarint(const uint8_t*& p) {
+        Wide x = 0;
+        for (int shift = 0;; shift += 7) {
+            uint8_t b = *p++;
+            x |= Wide(b & 0x7F) << shift;
+            if (!(b & 0x80)) return x;
+        }
+    }
+    static Wide zigzag(long long v) { return Wide((uint64_t(v) << 1) ^ uint64_t(v >> 63)); }
+    static long long unzigzag(Wide z) { return (long long)(z >> 1) ^ -(long long)(z & 1); }
+
+    static vector<uint8_t> encodeFull(const vector<Weight>& dist) {
+        vector<uint8_t> out;
+        out.reserve(dist.size() * 2);
+        for (Weight d : dist) putVarint(out, d == Traits::infinity() ? 0 : zigzag(d) + 1);
+        return out;
+    }
+    vector<Weight> decodeFull(const vector<uint8_t>& bytes) const {
+        vector<Weight> dist(n);
+        const uint8_t* p = bytes.data();
+        for (int i = 0; i < n; i++) {
+            Wide z = getVarint(p);
+            dist[i] = z == 0 ? Traits::infinity() : Weight(unzigzag(z - 1));
+        }
+        return dist;
+    }
+
+    static vector<uint8_t> encodePrefix(const vector<pair<int, Weight>>& settled) {
+        vector<uint8_t> out;
+        putVarint(out, settled.size());
+        long long prevNode = 0, prevDist = settled.empty() ? 0 : settled[0].second;
+        putVarint(out, zigzag(prevDist));
+        for (auto& [node, d] : settled) {
+            putVarint(out, zigzag(node - prevNode));
+            putVarint(out, Wide(d - prevDist));  // Settle order: distances never decrease
+            prevNode = node;
+            prevDist = d;
+        }
+        return out;
+    }
+    static vector<pair<int, Weight>> decodePrefix(const vector<uint8_t>& bytes, Weight radius) {
+        const uint8_t* p = bytes.data();
+        size_t count = getVarint(p);
+        long long node = 0, d = unzigzag(getVarint(p));
+        vector<pair<int, Weight>> settled;
+        for (size_t i = 0; i < count; i++) {
+            node += unzigzag(getVarint(p));
+            d += (long long)getVarint(p);
+            if (d > radius) break;  // Rest of the prefix lies beyond the requested radius
+            settled.push_back({(int)node, Weight(d)});
+        }
+        return settled;
+    }
+
+    size_t capacity;
+    int n = 0;
+    vector<vector<Weight>>* graph = nullptr;
+    uint64_t version = ~0ULL;
+
+    mutable mutex lock;
+    list<Entry> lru;  // Most recently used first
+    unordered_map<Key, typename list<Entry>::iterator, KeyHash> index;
+    size_t resident = 0;  // Encoded bytes held
+    Stats counts;
+};
+
+int main() {
+    // 60x60 grid with random weights; 80% of the queries hit 50 hot sources.
+    int side = 60, V = side * side;
+    mt19937 rng(9);
+    vector<vector<int>> adj[V];
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            int id = r * side + c;
+            if (c + 1 < side) { int w = rng() % 20 + 1; adj[id].push_back({id + 1, w}); adj[id + 1].push_back({id, w}); }
+            if (r + 1 < side) { int w = rng() % 20 + 1; adj[id].push_back({id + side, w}); adj[id + side].push_back({id, w}); }
+        }
+    }
+    vector<int> hot(50);
+    for (int& s : hot) s = rng() % V;
+    vector<int> queries;
+    for (int q = 0; q < 1000; q++) queries.push_back(rng() % 5 ? hot[rng() % hot.size()] : rng() % V);
+
+    SsspDistanceCache<int> cache(1 << 20);  // 1 MB of encoded vectors
+    cache.setGraph(V, adj, 1);
+
+    auto time = [](auto&& fn) {
+        auto t0 = chrono::steady_clock::now();
+        fn();
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+    };
+    int mismatches = 0;
+    double tPlain = time([&] {
+        for (int s : queries) dijkstra_impl::Solution().dijkstra(V, adj, s);
+    });
+    double tCached = time([&] {
+        for (int s : queries) mismatches += cache.distances(s) != dijkstra_impl::Solution().dijkstra(V, adj, s) ? 1 : 0;
+    });
+    double tCachedOnly = time([&] {
+        for (int s : queries) cache.distances(s);
+    });
+    auto st = cache.stats();
+    cout << "Plain: " << tPlain << " ms, cached (with verification): " << tCached << " ms, cached only: " << tCachedOnly
+         << " ms" << endl;
+    cout << "Mismatches: " << mismatches << ", hit rate: " << st.hitRate() << ", entries: " << st.entries
+         << ", bytes: " << st.bytes << " (raw " << st.entries * V * sizeof(int) << "), evictions: " << st.evictions << endl;
+
+    // Bounded queries: a cached larger radius answers a smaller one.
+    auto full = dijkstra_impl::Solution().dijkstra(V, adj, hot[0]);
+    bool prefixOk = true;
+    for (int radius : {200, 50, 120}) {
+        auto got = cache.withinRadius(hot[0], radius);
+        int expected = count_if(full.begin(), full.end(), [&](int d) { return d <= radius; });
+        prefixOk = prefixOk && (int)got.size() == expected;
+        for (size_t i = 0; i < got.size(); i++) {
+            prefixOk = prefixOk && full[got[i].first] == got[i].second && (i == 0 || got[i - 1].second <= got[i].second);
+        }
+    }
+    cout << "Bounded queries correct: " << (prefixOk ? "yes" : "no") << endl;
+
+    // A new graph version invalidates everything.
+    adj[hot[0]][0][1] = 1;
+    cache.setGraph(V, adj, 2);
+    bool fresh = cache.distances(hot[0]) == dijkstra_impl::Solution().dijkstra(V, adj, hot[0]);
+    cout << "After version bump: invalidated " << cache.stats().invalidations << " entries, fresh result: "
+         << (fresh ? "yes" : "no") << endl;
+    return 0;
+}
@@ -34,6 +34,12 @@ class Solution {
 public:
     // Function to return the list containing vertices in Topological order
     vector<int> topoSort(int V, vector<int> adj[]) {
+        return topoSort<vector<int>*>(V, adj);
+    }
+
+    // Same, for vector<vector<int>> or any type with the same adj[u] iteration (Compression/compressed_graph.h).
+    template <class Graph>
+    vector<int> topoSort(int V, const Graph& adj) {
         int indegree[V] = {0};  // Array to store the indegree of each vertex
         
         // Step 1: Calculate the indegree for each node
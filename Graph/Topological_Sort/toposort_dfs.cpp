@@ -26,7 +26,9 @@ using namespace std;
 
 */
 
-void dfs(int node, vector<int>& vis, stack<int>& st, vector<vector<int>>& adj){
+// Graph is vector<vector<int>> or any type with the same adj[u] iteration and size() (Compression/compressed_graph.h).
+template <class Graph>
+void dfs(int node, vector<int>& vis, stack<int>& st, const Graph& adj){
     vis[node] = 1;  // Mark the node as visited
     for (auto it : adj[node]) {  // Explore all adjacent nodes (edges)
         if (!vis[it]) {  // If the adjacent node is not visited, perform DFS
@@ -36,7 +38,8 @@ void dfs(int node, vector<int>& vis, stack<int>& st, vector<vector<int>>& adj){
     st.push(node);  // After all neighbors are processed, push the node onto the stack
 }
 
-vector<int> topologicalSort(vector<vector<int>>& adj) {
+template <class Graph>
+vector<int> topologicalSort(const Graph& adj) {
     int n = adj.size();  // Number of nodes in the graph
     vector<int> vis(n, 0);  // Vector to keep track of visited nodes
     stack<int> st;  // Stack to store nodes in reverse topological order
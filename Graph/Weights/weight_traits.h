@@ -0,0 +1,67 @@
+#ifndef GRAPH_WEIGHTS_WEIGHT_TRAITS_H
+#define GRAPH_WEIGHTS_WEIGHT_TRAITS_H
+
+#include <limits>
+#include <type_traits>
+
+/*
+    Weight types for the shortest path and spanning tree templates.
+
+    dijkstra, bellmanFord, shortest_distance (Floyd-Warshall), shortestPath (DAG) and both spanningTree
+    variants are templated on the weight type, deduced from the adjacency / edge list they are given
+    (e.g. `vector<vector<long long>> adj[]`), and on a `Traits` type describing it:
+
+    - `Weight`         : the distance type.
+    - `infinity()`     : constexpr "unreachable" sentinel.
+    - `add(a, b)`      : saturating sum. Infinity absorbs everything, and an overflowing sum clamps to
+                         infinity (or to the lowest value when it overflows downwards), so relaxing from an
+                         unreachable node never produces a bogus small distance.
+
+    Provided traits:
+    - **WeightTraits<T>**: infinity is numeric_limits<T>::max() for integers and +inf for floating point.
+      WeightTraits<int> is exactly the INT_MAX sentinel dijkstra always used.
+    - **SentinelWeightTraits<T, Sentinel>**: a fixed finite sentinel. bellmanFord<int> defaults to
+      SentinelWeightTraits<int, 100000000> so its output keeps the historical 1e8 value for unreachable nodes.
+
+    Everything is resolved at compile time: there is no runtime branching on the weight type, and
+    `int` instantiations compile to the same loops as before plus the overflow check.
+
+    Usage:
+        vector<vector<long long>> adj[V];  // adj[u] = {{v, w}, ...}
+        vector<long long> dist = Solution().dijkstra(V, adj, S);       // Weight = long long, deduced
+        vector<int> legacy = Solution().bellmanFord<int, WeightTraits<int>>(V, edges, S);  // INT_MAX sentinel
+*/
+
+// Saturating a + b shared by all traits; `Traits::infinity()` is the absorbing / clamping value.
+template <class Traits, class T>
+constexpr T saturatingAdd(T a, T b) {
+    constexpr T inf = Traits::infinity();
+    if (a == inf || b == inf) return inf;
+    if constexpr (std::is_floating_point<T>::value) {
+        T sum = a + b;
+        return sum >= inf ? inf : sum;
+    } else {
+        T sum;
+        if (__builtin_add_overflow(a, b, &sum)) return b > 0 ? inf : std::numeric_limits<T>::lowest();
+        return sum >= inf ? inf : sum;
+    }
+}
+
+template <class T>
+struct WeightTraits {
+    using Weight = T;
+    static constexpr T infinity() {
+        return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                    : std::numeric_limits<T>::max();
+    }
+    static constexpr T add(T a, T b) { return saturatingAdd<WeightTraits>(a, b); }
+};
+
+template <class T, long long Sentinel>
+struct SentinelWeightTraits {
+    using Weight = T;
+    static constexpr T infinity() { return T(Sentinel); }
+    static constexpr T add(T a, T b) { return saturatingAdd<SentinelWeightTraits>(a, b); }
+};
+
+#endif
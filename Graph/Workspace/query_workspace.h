@@ -0,0 +1,91 @@
+#ifndef GRAPH_WORKSPACE_QUERY_WORKSPACE_H
+#define GRAPH_WORKSPACE_QUERY_WORKSPACE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/*
+    Reusable per-query scratch memory for the graph routines.
+
+    Every plain call allocates and zero-fills O(V) arrays (vis, distTo, dist, timer, low ...). When a query only
+    touches a small part of a huge graph, that initialization dominates. A QueryWorkspace is created once per
+    thread and handed to the workspace overloads of:
+    - shortestPath (unit-weight BFS)        Shortet_Path/shortest_path_in_undirected_graph_with_unit_weight.cpp
+    - dijkstra                              Shortet_Path/dijkstras_positive_weights.cpp
+    - shortestPath (DAG)                    Shortet_Path/shortest_path_in_directed_acyclic_graph.cpp
+    - articulationPoints                    Branch_And_Artulication_Point/articulation_point.cpp
+    - criticalConnections (bridges)         Branch_And_Artulication_Point/branch.cpp
+
+    How resetting becomes O(1):
+    - **StampedArray<T>**: every slot carries the epoch it was written in. `reset()` just increments the epoch, so
+      all slots read back as the fallback value again (a full clear only happens when the 32-bit epoch wraps).
+    - **Buffers** (`nodes`, `order`, `heap`) are vectors that are cleared, never freed: after the first few queries
+      they stop allocating, like an arena that is rewound between queries.
+    - `begin(n, fallback)` grows the arrays if the graph got bigger (amortized) and resets everything.
+
+    Results stay in the workspace until the next query: `dist.get(v)` and the `order` list of the nodes the query
+    reached, so a caller can read the answer without an O(V) output vector.
+
+    A workspace is not thread-safe; use one per thread.
+*/
+
+template <class T>
+class StampedArray {
+public:
+    void ensure(size_t n) {
+        if (values.size() < n) {
+            values.resize(n);
+            stamps.resize(n, 0);
+        }
+    }
+
+    // Every slot reads as `value` again.
+    void reset(T value) {
+        fallback = value;
+        if (++epoch == 0) {  // Wrapped around: stale stamps could alias the new epoch
+            std::fill(stamps.begin(), stamps.end(), 0);
+            epoch = 1;
+        }
+    }
+
+    bool has(int i) const { return stamps[i] == epoch; }
+    T get(int i) const { return stamps[i] == epoch ? values[i] : fallback; }
+    void set(int i, T value) {
+        stamps[i] = epoch;
+        values[i] = value;
+    }
+
+private:
+    std::vector<T> values;
+    std::vector<uint32_t> stamps;
+    uint32_t epoch = 0;
+    T fallback = T();
+};
+
+template <class Weight = int>
+struct QueryWorkspace {
+    StampedArray<Weight> dist;            // Distances (fallback: the routine's "unreachable" value)
+    StampedArray<int> timer, low, state;  // DFS discovery time / low-link / visited-or-settled flags
+    std::vector<int> nodes;               // Queue / stack buffer
+    std::vector<int> order;               // Nodes reached by the last query, in visit or settle order
+    std::vector<std::pair<Weight, int>> heap;
+
+    // Prepares for a query on an n-node graph: O(1) amortized.
+    void begin(int n, Weight unreachable) {
+        dist.ensure(n);
+        timer.ensure(n);
+        low.ensure(n);
+        state.ensure(n);
+        dist.reset(unreachable);
+        timer.reset(-1);
+        low.reset(-1);
+        state.reset(0);
+        nodes.clear();
+        order.clear();
+        heap.clear();
+    }
+};
+
+#endif